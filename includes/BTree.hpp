@@ -0,0 +1,839 @@
+#ifndef BTREE_HPP
+# define BTREE_HPP
+
+#include <memory>
+#include "BTreeIterator.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief BTree class
+	 * btree_map/btree_set base - B-Tree
+	 *
+	 * RBTree는 원소마다 노드를 할당하고 원소 하나를 비교할 때마다 다른 cache line으로 이동한다.
+	 * B-Tree는 한 노드에 정렬된 원소를 여러 개(slots) 저장하는 균형 탐색 트리이다.
+	 * -> 트리의 높이가 log_slots(N)으로 낮아지고, 노드 하나 안의 비교는 연속된 메모리 안에서 이진 탐색으로 끝난다.
+	 * -> 순회는 leaf 안의 배열을 차례로 읽으므로 prefetch가 잘 동작한다.
+	 * -> 노드 수가 원소 수 / slots 정도이므로 할당 횟수와 원소당 메모리도 줄어든다.
+	 *
+	 * 속성
+	 * 1. 모든 leaf는 같은 깊이에 있다.
+	 * 2. 노드의 원소는 정렬되어 있고, 내부 노드의 i번째 자식 서브트리의 원소는 value(i - 1)과 value(i) 사이에 있다.
+	 * 3. root가 아닌 노드는 최소 min_values개의 원소를 가진다. (insert 직후의 오른쪽 끝 노드는 예외적으로 적을 수 있다.)
+	 *
+	 * 삽입 - leaf에 넣고, leaf가 가득 차 있으면 둘로 나누어 가운데 원소를 부모로 올린다. (부모도 가득 차 있으면 먼저 나눈다)
+	 *        가장 오른쪽 끝에 붙이는 경우(정렬된 입력)에는 왼쪽 노드를 가득 채운 채로 나누어 노드가 반만 차는 것을 막는다.
+	 * 삭제 - leaf에서 지운다. 내부 노드의 원소는 바로 앞 원소(leaf에 있다)로 대체한 뒤 그 leaf에서 지운다.
+	 *        원소가 min_values보다 적어지면 형제 노드와 합치거나(merge) 형제의 원소를 나누어 받는다(rebalance).
+	 *
+	 * 원소가 노드 사이를 이동하기 때문에 insert/erase 후에는 모든 iterator가 무효화된다. (std::map과 다른 점)
+	 *
+	 * 시간복잡도
+	 * 삽입/삭제/탐색 = O(logN)
+	 *
+	 * @tparam T		value_type (pair of key and mapped_type)
+	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.
+	 * @tparam NodeBytes	노드 하나의 목표 크기(바이트). slot 수는 이 크기에 들어가는 원소 수이다. (최소 3)
+	 */
+	template < typename T, typename Compare = ft::less<T>, typename Alloc = std::allocator<T>, size_t NodeBytes = 256 >
+	class BTree {
+		public :
+			/**
+			 * @brief Member types
+			 */
+			typedef T	value_type;
+			typedef T*	pointer;
+			typedef const T*	const_pointer;
+			typedef T&	reference;
+			typedef const T&	const_reference;
+			typedef Compare	value_comp;
+			typedef Alloc	allocator_type;
+			typedef size_t	size_type;
+			typedef ft::BTreeNode<T, ft::BTreeSlots<T, NodeBytes>::value>	node_type;
+			typedef ft::BTreeInternalNode<T, ft::BTreeSlots<T, NodeBytes>::value>	internal_node_type;
+			typedef typename ft::BTreeIterator<T, T*, T&, node_type>	iterator;
+			typedef typename ft::BTreeIterator<T, const T*, const T&, node_type>	const_iterator;
+			//leaf와 내부 노드는 크기가 다르므로 각각 rebind한다.
+			typedef typename Alloc::template rebind<node_type>::other	leaf_allocator_type;
+			typedef typename Alloc::template rebind<internal_node_type>::other	internal_allocator_type;
+
+			static const size_type	slots = ft::BTreeSlots<T, NodeBytes>::value;
+			static const size_type	min_values = (ft::BTreeSlots<T, NodeBytes>::value - 1) / 2;
+
+		private:
+			/**
+			 * @brief Member variables
+			 */
+			//tree가 비어있으면 NULL
+			node_type*	_root;
+			//가장 왼쪽/오른쪽 leaf. begin()과 end()를 O(1)로 만든다.
+			node_type*	_leftmost;
+			node_type*	_rightmost;
+			size_type	_size;
+			value_comp	_comp;
+			allocator_type	_alloc;
+			leaf_allocator_type	_leaf_alloc;
+			internal_allocator_type	_internal_alloc;
+
+		public:
+			/**
+			 * @brief Member functions
+			 */
+			//Default constructor
+			explicit BTree(const value_comp& comp = value_comp(), const allocator_type& alloc = allocator_type())
+			: _root(NULL), _leftmost(NULL), _rightmost(NULL), _size(0), _comp(comp), _alloc(alloc), _leaf_alloc(alloc), _internal_alloc(alloc) {}
+
+			//Copy constructor
+			BTree(const BTree& x)
+			: _root(NULL), _leftmost(NULL), _rightmost(NULL), _size(0), _comp(x._comp), _alloc(x._alloc), _leaf_alloc(x._leaf_alloc), _internal_alloc(x._internal_alloc)
+			{
+				copy(x);
+			}
+
+			//Destructor
+			~BTree()
+			{
+				clear();
+			}
+
+#ifdef FT_CXX11
+			//Move constructor
+			//빈 tree를 만든 뒤 x와 바꾼다. -> 노드를 옮기지 않는다.
+			BTree(BTree&& x)
+			: _root(NULL), _leftmost(NULL), _rightmost(NULL), _size(0), _comp(x._comp), _alloc(x._alloc), _leaf_alloc(x._leaf_alloc), _internal_alloc(x._internal_alloc)
+			{
+				swap(x);
+			}
+
+			//Move assignment operator
+			BTree& operator=(BTree&& x)
+			{
+				if (this != &x)
+				{
+					clear();
+					swap(x);
+				}
+				return (*this);
+			}
+#endif
+
+			//Assignment operator
+			BTree& operator=(const BTree& x)
+			{
+				if (this != &x)
+					copy(x);
+				return (*this);
+			}
+
+			//x의 노드 구조를 그대로 복제한다. 비교 없이 노드마다 한 번씩 -> O(N)
+			void copy(const BTree& x)
+			{
+				clear();
+				if (x._size == 0)
+					return ;
+				this->_root = clone(x._root, NULL, 0);
+				this->_size = x._size;
+				this->_leftmost = this->_root;
+				while (!this->_leftmost->leaf)
+					this->_leftmost = this->_leftmost->child(0);
+				this->_rightmost = this->_root;
+				while (!this->_rightmost->leaf)
+					this->_rightmost = this->_rightmost->child(this->_rightmost->count);
+			}
+
+			//Iterators
+			iterator get_begin() const
+			{
+				return (iterator(this->_leftmost, 0));
+			}
+
+			//가장 오른쪽 leaf의 마지막 원소 다음 위치
+			iterator get_end() const
+			{
+				if (this->_rightmost == NULL)
+					return (iterator());
+				return (iterator(this->_rightmost, this->_rightmost->count));
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_size == 0);
+			}
+
+			size_type size() const
+			{
+				return (this->_size);
+			}
+
+			size_type max_size() const
+			{
+				return (this->_alloc.max_size());
+			}
+
+			/**
+			 * @brief insert
+			 * val과 같은 key가 있으면 (그 원소, false), 없으면 (새 원소, true)를 반환한다.
+			 * root부터 노드마다 이진 탐색으로 내려가며 leaf의 삽입 위치를 찾는다.
+			 * c++11에서는 val을 slot에 생성할 때까지 그대로 넘긴다. (value_type&&이면 move)
+			 */
+#ifdef FT_CXX11
+			template <class V>
+			ft::pair<iterator, bool> insert(V&& val)
+#else
+			ft::pair<iterator, bool> insert(const value_type& val)
+#endif
+			{
+				if (this->_root == NULL)
+				{
+					this->_root = make_node(true);
+					this->_leftmost = this->_root;
+					this->_rightmost = this->_root;
+				}
+				node_type* node = this->_root;
+				for (;;)
+				{
+					size_type pos = lower_bound_in_node(node, val);
+					if (pos < node->count && !this->_comp(val, node->value(pos)))
+						return (ft::make_pair(iterator(node, pos), false));
+					if (node->leaf)
+						return (ft::make_pair(insert_leaf(node, pos, FT_FORWARD(V, val)), true));
+					node = node->child(pos);
+				}
+			}
+
+			//hint 바로 앞이 삽입 위치이면 탐색 없이 삽입한다. 아니면 hint를 무시하고 root부터 찾는다.
+			//RBTree::get_hint_position과 같은 규칙을 따른다.
+#ifdef FT_CXX11
+			template <class V>
+			ft::pair<iterator, bool> insert(V&& val, iterator hint)
+#else
+			ft::pair<iterator, bool> insert(const value_type& val, iterator hint)
+#endif
+			{
+				if (this->_size == 0)
+					return (insert(FT_FORWARD(V, val)));
+				if (hint == get_end())
+				{
+					if (this->_comp(this->_rightmost->value(this->_rightmost->count - 1), val))
+						return (ft::make_pair(insert_before(hint, FT_FORWARD(V, val)), true));
+				}
+				else if (this->_comp(val, *hint))
+				{
+					iterator prev = hint;
+					if (hint == get_begin() || this->_comp(*--prev, val))
+						return (ft::make_pair(insert_before(hint, FT_FORWARD(V, val)), true));
+				}
+				else if (this->_comp(*hint, val))
+				{
+					iterator next = hint;
+					++next;
+					if (next == get_end() || this->_comp(val, *next))
+						return (ft::make_pair(insert_before(next, FT_FORWARD(V, val)), true));
+				}
+				else
+					return (ft::make_pair(hint, false));
+				return (insert(FT_FORWARD(V, val)));
+			}
+
+			//정렬된 입력은 end를 hint로 주어 가장 오른쪽 leaf에 바로 붙인다.
+			//*first가 value_type이 아니면 한 번만 변환해서 넘긴다. (비교할 때마다 변환하지 않는다)
+			template <typename InputIterator>
+			void insert_range(InputIterator first, InputIterator last)
+			{
+				for (; first != last; ++first)
+					insert(static_cast<const value_type&>(*first), get_end());
+			}
+
+			/**
+			 * @brief erase
+			 * position을 지우고 다음 원소를 가리키는 iterator를 반환한다.
+			 */
+			iterator erase(iterator position)
+			{
+				node_type* node = position.base();
+				int pos = position.position();
+				bool internal_delete = !node->leaf;
+				destroy_value(node->slot(pos));
+				if (internal_delete)
+				{	// 내부 노드 -> 바로 앞 원소(왼쪽 서브트리의 가장 오른쪽 leaf의 마지막 원소)를 빈 자리로 옮긴다.
+					iterator prev = position;
+					--prev;
+					relocate(node->slot(pos), prev.base()->slot(prev.position()));
+					node = prev.base();
+					pos = prev.position();
+				}
+				else
+					shift_left(node, pos + 1, 1);
+				--node->count;
+				--this->_size;
+				iterator next = rebalance_after_erase(node, pos);
+				// 내부 노드에서 지웠다면 next는 옮겨온 앞 원소를 가리키므로 한 칸 더 간다.
+				if (internal_delete)
+					++next;
+				return (next);
+			}
+
+			template <typename K>
+			size_type erase_key(const K& k)
+			{
+				iterator it = find(k);
+				if (it == get_end())
+					return (0);
+				erase(it);
+				return (1);
+			}
+
+			//erase가 iterator를 무효화하므로 last 대신 지울 원소 수를 센다.
+			void erase_range(iterator first, iterator last)
+			{
+				if (first == get_begin() && last == get_end())
+				{
+					clear();
+					return ;
+				}
+				size_type n = 0;
+				for (iterator it = first; it != last; ++it)
+					++n;
+				while (n--)
+					first = erase(first);
+			}
+
+			//root/leftmost/rightmost pointer와 size, 비교 함수만 바꾼다. -> 노드를 옮기지 않는다.
+			//allocator는 vector::swap과 같은 규칙으로 c++11부터 propagate_on_container_swap일 때만 바꾼다. (c++98은 항상 바꾼다)
+			//바꾸지 않는 allocator끼리는 같아야 한다. (다르면 std와 마찬가지로 undefined)
+			void swap(BTree& x)
+			{
+				if (this == &x)
+					return ;
+				swap(_root, x._root);
+				swap(_leftmost, x._leftmost);
+				swap(_rightmost, x._rightmost);
+				swap(_size, x._size);
+				swap(_comp, x._comp);
+#ifdef FT_CXX11
+				if (std::allocator_traits<allocator_type>::propagate_on_container_swap::value)
+#endif
+				{
+					swap(_alloc, x._alloc);
+					swap(_leaf_alloc, x._leaf_alloc);
+					swap(_internal_alloc, x._internal_alloc);
+				}
+			}
+
+			void clear()
+			{
+				destroy_subtree(this->_root);
+				this->_root = NULL;
+				this->_leftmost = NULL;
+				this->_rightmost = NULL;
+				this->_size = 0;
+			}
+
+			//Operations
+			template <typename K>
+			iterator find(const K& k) const
+			{
+				node_type* node = this->_root;
+				while (node)
+				{
+					size_type pos = lower_bound_in_node(node, k);
+					if (pos < node->count && !this->_comp(k, node->value(pos)))
+						return (iterator(node, pos));
+					if (node->leaf)
+						break;
+					node = node->child(pos);
+				}
+				return (get_end());
+			}
+
+			//더 깊은 노드에서 찾은 후보가 항상 더 작으므로 마지막 후보가 답이다.
+			template <typename K>
+			iterator lower_bound(const K& k) const
+			{
+				iterator res = get_end();
+				node_type* node = this->_root;
+				while (node)
+				{
+					size_type pos = lower_bound_in_node(node, k);
+					if (pos < node->count)
+						res = iterator(node, pos);
+					if (node->leaf)
+						break;
+					node = node->child(pos);
+				}
+				return (res);
+			}
+
+			template <typename K>
+			iterator upper_bound(const K& k) const
+			{
+				iterator res = get_end();
+				node_type* node = this->_root;
+				while (node)
+				{
+					size_type pos = upper_bound_in_node(node, k);
+					if (pos < node->count)
+						res = iterator(node, pos);
+					if (node->leaf)
+						break;
+					node = node->child(pos);
+				}
+				return (res);
+			}
+
+			//Allocator
+			allocator_type get_allocator() const
+			{
+				return (this->_alloc);
+			}
+
+		private:
+			//노드 안에서 k보다 작지 않은 첫 원소의 위치
+			template <typename K>
+			size_type lower_bound_in_node(const node_type* node, const K& k) const
+			{
+				size_type lo = 0;
+				size_type hi = node->count;
+				while (lo < hi)
+				{
+					size_type mid = (lo + hi) / 2;
+					if (this->_comp(node->value(mid), k))
+						lo = mid + 1;
+					else
+						hi = mid;
+				}
+				return (lo);
+			}
+
+			//노드 안에서 k보다 큰 첫 원소의 위치
+			template <typename K>
+			size_type upper_bound_in_node(const node_type* node, const K& k) const
+			{
+				size_type lo = 0;
+				size_type hi = node->count;
+				while (lo < hi)
+				{
+					size_type mid = (lo + hi) / 2;
+					if (this->_comp(k, node->value(mid)))
+						hi = mid;
+					else
+						lo = mid + 1;
+				}
+				return (lo);
+			}
+
+			//내부 노드 앞에 넣으려면 바로 앞 원소(leaf의 마지막) 뒤에 넣는다. -> 삽입은 항상 leaf에서 일어난다.
+#ifdef FT_CXX11
+			template <class V>
+			iterator insert_before(iterator position, V&& val)
+#else
+			iterator insert_before(iterator position, const value_type& val)
+#endif
+			{
+				if (!position.base()->leaf)
+				{
+					--position;
+					return (insert_leaf(position.base(), position.position() + 1, FT_FORWARD(V, val)));
+				}
+				return (insert_leaf(position.base(), position.position(), FT_FORWARD(V, val)));
+			}
+
+#ifdef FT_CXX11
+			template <class V>
+			iterator insert_leaf(node_type* node, size_type pos, V&& val)
+#else
+			iterator insert_leaf(node_type* node, size_type pos, const value_type& val)
+#endif
+			{
+				if (node->count == slots)
+				{
+					node_type* sibling = split(node, split_point(node, pos));
+					if (pos > node->count)
+					{
+						pos -= node->count + 1;
+						node = sibling;
+					}
+				}
+				shift_right(node, pos, 1);
+				try
+				{
+					this->_alloc.construct(node->slot(pos), FT_FORWARD(V, val));
+				}
+				catch (...)
+				{
+					shift_left(node, pos + 1, 1);
+					throw;
+				}
+				++node->count;
+				++this->_size;
+				return (iterator(node, pos));
+			}
+
+			//가득 찬 노드의 pos에 원소가 들어올 때 나눌 위치
+			//오른쪽 끝에 붙이는 경우에는 왼쪽 노드를 가득 채운다. -> 정렬된 입력에서도 노드가 거의 가득 찬다.
+			size_type split_point(node_type* node, size_type pos) const
+			{
+				if (pos == node->count && is_right_edge(node))
+					return (node->count - 1);
+				return (node->count / 2);
+			}
+
+			bool is_right_edge(node_type* node) const
+			{
+				for (; node->parent; node = node->parent)
+				{
+					if (node->position != node->parent->count)
+						return (false);
+				}
+				return (true);
+			}
+
+			/**
+			 * @brief split
+			 * node의 value(mid)를 부모로 올리고, mid 뒤의 원소(와 자식)를 새 오른쪽 형제로 옮긴다.
+			 * 부모가 가득 차 있으면 부모를 먼저 나누고, node가 root이면 새 root를 만든다.
+			 * @return 새 오른쪽 형제
+			 */
+			node_type* split(node_type* node, size_type mid)
+			{
+				if (node->parent == NULL)
+				{
+					node_type* root = make_node(false);
+					set_child(root, 0, node);
+					this->_root = root;
+				}
+				else if (node->parent->count == slots)
+					split(node->parent, split_point(node->parent, node->position));
+				node_type* parent = node->parent;
+				size_type index = node->position;
+				node_type* sibling = make_node(node->leaf);
+				size_type moved = node->count - mid - 1;
+				for (size_type i = 0; i < moved; ++i)
+					relocate(sibling->slot(i), node->slot(mid + 1 + i));
+				if (!node->leaf)
+				{
+					for (size_type i = 0; i <= moved; ++i)
+						set_child(sibling, i, node->child(mid + 1 + i));
+				}
+				sibling->count = moved;
+				// 가운데 원소를 부모의 index에 넣고, 새 형제를 index + 1번째 자식으로 연결한다.
+				shift_right(parent, index, 1);
+				shift_children_right(parent, index + 1, 1);
+				relocate(parent->slot(index), node->slot(mid));
+				set_child(parent, index + 1, sibling);
+				++parent->count;
+				node->count = mid;
+				if (node == this->_rightmost)
+					this->_rightmost = sibling;
+				return (sibling);
+			}
+
+			/**
+			 * @brief rebalance_after_erase
+			 * node의 pos에서 원소를 지운 뒤, 원소가 부족한 노드를 root까지 올라가며 합치거나 나누어 받는다.
+			 * @return 지운 원소의 다음 원소를 가리키는 iterator
+			 */
+			iterator rebalance_after_erase(node_type* node, int pos)
+			{
+				node_type* res_node = node;
+				int res_pos = pos;
+				bool first = true;
+				for (;;)
+				{
+					if (node == this->_root)
+					{
+						if (node->count == 0)
+						{
+							if (node->leaf)
+							{	// 마지막 원소를 지웠다.
+								delete_node(node);
+								this->_root = NULL;
+								this->_leftmost = NULL;
+								this->_rightmost = NULL;
+								return (get_end());
+							}
+							// 원소가 없는 root는 하나 남은 자식으로 대체한다. -> 높이가 1 줄어든다.
+							this->_root = node->child(0);
+							this->_root->parent = NULL;
+							this->_root->position = 0;
+							delete_node(node);
+						}
+						break;
+					}
+					if (node->count >= min_values)
+						break;
+					bool merged = merge_or_rebalance(node, pos);
+					// 처음 옮겨진 노드(leaf)에서 지운 위치를 다시 잡는다.
+					if (first)
+					{
+						res_node = node;
+						res_pos = pos;
+						first = false;
+					}
+					if (!merged)
+						break;
+					pos = node->position;
+					node = node->parent;
+				}
+				iterator res(res_node, res_pos);
+				// 노드의 끝이면 다음 원소는 조상에 있다.
+				if (res_pos == res_node->count)
+				{
+					res = iterator(res_node, res_pos - 1);
+					++res;
+				}
+				return (res);
+			}
+
+			//형제와 합칠 수 있으면 합치고(true), 아니면 원소가 많은 형제에게서 차이의 절반을 받는다(false).
+			//node와 pos는 옮겨진 뒤의 위치로 바뀐다.
+			bool merge_or_rebalance(node_type*& node, int& pos)
+			{
+				node_type* parent = node->parent;
+				if (node->position > 0)
+				{
+					node_type* left = parent->child(node->position - 1);
+					if (size_type(left->count) + node->count + 1 <= slots)
+					{
+						pos += left->count + 1;
+						merge(left, node);
+						node = left;
+						return (true);
+					}
+				}
+				if (node->position < parent->count)
+				{
+					node_type* right = parent->child(node->position + 1);
+					if (size_type(node->count) + right->count + 1 <= slots)
+					{
+						merge(node, right);
+						return (true);
+					}
+					size_type n = (right->count - node->count) / 2;
+					rotate_left(node, right, n > 0 ? n : 1);
+					return (false);
+				}
+				node_type* left = parent->child(node->position - 1);
+				size_type n = (left->count - node->count) / 2;
+				n = (n > 0 ? n : 1);
+				rotate_right(left, node, n);
+				pos += n;
+				return (false);
+			}
+
+			//부모의 구분 원소와 right의 모든 원소(와 자식)를 left 뒤로 옮기고 right를 해제한다.
+			void merge(node_type* left, node_type* right)
+			{
+				node_type* parent = left->parent;
+				size_type index = left->position;
+				size_type count = left->count;
+				relocate(left->slot(count), parent->slot(index));
+				for (size_type i = 0; i < right->count; ++i)
+					relocate(left->slot(count + 1 + i), right->slot(i));
+				if (!left->leaf)
+				{
+					for (size_type i = 0; i <= right->count; ++i)
+						set_child(left, count + 1 + i, right->child(i));
+				}
+				left->count += right->count + 1;
+				shift_left(parent, index + 1, 1);
+				shift_children_left(parent, index + 2, 1);
+				--parent->count;
+				if (right == this->_rightmost)
+					this->_rightmost = left;
+				right->count = 0;
+				delete_node(right);
+			}
+
+			//right의 앞쪽 원소 n개를 부모를 거쳐 left로 옮긴다.
+			void rotate_left(node_type* left, node_type* right, size_type n)
+			{
+				node_type* parent = left->parent;
+				size_type index = left->position;
+				size_type count = left->count;
+				relocate(left->slot(count), parent->slot(index));
+				for (size_type i = 0; i + 1 < n; ++i)
+					relocate(left->slot(count + 1 + i), right->slot(i));
+				relocate(parent->slot(index), right->slot(n - 1));
+				shift_left(right, n, n);
+				if (!left->leaf)
+				{
+					for (size_type i = 0; i < n; ++i)
+						set_child(left, count + 1 + i, right->child(i));
+					shift_children_left(right, n, n);
+				}
+				left->count += n;
+				right->count -= n;
+			}
+
+			//left의 뒤쪽 원소 n개를 부모를 거쳐 right로 옮긴다.
+			void rotate_right(node_type* left, node_type* right, size_type n)
+			{
+				node_type* parent = left->parent;
+				size_type index = left->position;
+				size_type count = left->count;
+				shift_right(right, 0, n);
+				relocate(right->slot(n - 1), parent->slot(index));
+				for (size_type i = 0; i + 1 < n; ++i)
+					relocate(right->slot(i), left->slot(count - n + 1 + i));
+				relocate(parent->slot(index), left->slot(count - n));
+				if (!right->leaf)
+				{
+					shift_children_right(right, 0, n);
+					for (size_type i = 0; i < n; ++i)
+						set_child(right, i, left->child(count - n + 1 + i));
+				}
+				left->count -= n;
+				right->count += n;
+			}
+
+			//[first, count)의 원소를 n칸 뒤로 옮긴다. count는 바꾸지 않는다.
+			void shift_right(node_type* node, size_type first, size_type n)
+			{
+				for (size_type i = node->count; i > first; --i)
+					relocate(node->slot(i - 1 + n), node->slot(i - 1));
+			}
+
+			//[first, count)의 원소를 n칸 앞으로 옮긴다. count는 바꾸지 않는다.
+			void shift_left(node_type* node, size_type first, size_type n)
+			{
+				for (size_type i = first; i < node->count; ++i)
+					relocate(node->slot(i - n), node->slot(i));
+			}
+
+			//[first, count]의 자식을 n칸 뒤로 옮긴다.
+			void shift_children_right(node_type* node, size_type first, size_type n)
+			{
+				for (size_type i = node->count + 1; i > first; --i)
+					set_child(node, i - 1 + n, node->child(i - 1));
+			}
+
+			//[first, count]의 자식을 n칸 앞으로 옮긴다.
+			void shift_children_left(node_type* node, size_type first, size_type n)
+			{
+				for (size_type i = first; i <= node->count; ++i)
+					set_child(node, i - n, node->child(i));
+			}
+
+			void set_child(node_type* node, size_type i, node_type* child)
+			{
+				node->child(i) = child;
+				child->parent = node;
+				child->position = i;
+			}
+
+			//원소를 다른 slot으로 옮긴다. (c++98에는 move가 없으므로 복사 후 소멸)
+			void relocate(T* dst, T* src)
+			{
+				this->_alloc.construct(dst, *src);
+				destroy_value(src);
+			}
+
+			void destroy_value(T* p)
+			{
+				if (!ft::is_trivially_destructible<value_type>::value)
+					this->_alloc.destroy(p);
+			}
+
+			//원소가 없는 노드를 만든다. 내부 노드의 자식은 NULL로 초기화한다.
+			node_type* make_node(bool leaf)
+			{
+				node_type* node;
+				if (leaf)
+					node = this->_leaf_alloc.allocate(1);
+				else
+				{
+					internal_node_type* internal = this->_internal_alloc.allocate(1);
+					for (size_type i = 0; i <= slots; ++i)
+						internal->children[i] = NULL;
+					node = internal;
+				}
+				node->parent = NULL;
+				node->position = 0;
+				node->count = 0;
+				node->leaf = leaf;
+				return (node);
+			}
+
+			//원소는 이미 소멸/이동된 상태여야 한다.
+			void delete_node(node_type* node)
+			{
+				if (node->leaf)
+					this->_leaf_alloc.deallocate(node, 1);
+				else
+					this->_internal_alloc.deallocate(static_cast<internal_node_type*>(node), 1);
+			}
+
+			//서브트리의 원소를 소멸시키고 노드를 해제한다. 높이가 log_slots(N)이므로 재귀해도 깊지 않다.
+			void destroy_subtree(node_type* node)
+			{
+				if (node == NULL)
+					return ;
+				for (size_type i = 0; i < node->count; ++i)
+					destroy_value(node->slot(i));
+				if (!node->leaf)
+				{
+					for (size_type i = 0; i <= node->count; ++i)
+						destroy_subtree(node->child(i));
+				}
+				delete_node(node);
+			}
+
+			/**
+			 * @brief clone
+			 * src 서브트리를 복제한다.
+			 * 복제 도중 예외가 나면 지금까지 만든 원소와 노드를 정리하고 다시 던진다.
+			 * -> count는 원소(내부 노드는 원소와 그 오른쪽 자식)가 다 만들어진 뒤에 늘린다.
+			 */
+			node_type* clone(const node_type* src, node_type* parent, size_type position)
+			{
+				node_type* node = make_node(src->leaf);
+				node->parent = parent;
+				node->position = position;
+				try
+				{
+					if (src->leaf)
+					{
+						for (; node->count < src->count; ++node->count)
+							this->_alloc.construct(node->slot(node->count), src->value(node->count));
+					}
+					else
+					{
+						node->child(0) = clone(src->child(0), node, 0);
+						for (; node->count < src->count; ++node->count)
+						{
+							size_type i = node->count;
+							this->_alloc.construct(node->slot(i), src->value(i));
+							try
+							{
+								node->child(i + 1) = clone(src->child(i + 1), node, i + 1);
+							}
+							catch (...)
+							{
+								destroy_value(node->slot(i));
+								throw;
+							}
+						}
+					}
+				}
+				catch (...)
+				{
+					destroy_subtree(node);
+					throw;
+				}
+				return (node);
+			}
+
+			template <typename _T>
+			void swap(_T& a, _T& b)
+			{
+				_T tmp(a);
+				a = b;
+				b = tmp;
+			}
+	};
+} // namespace ft
+
+#endif
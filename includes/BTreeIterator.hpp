@@ -0,0 +1,168 @@
+#ifndef BTREEITERATOR_HPP
+# define BTREEITERATOR_HPP
+
+#include "utils.hpp"
+#include "BTreeNode.hpp"
+
+/**
+ * @brief B-Tree Iterator
+ *
+ * btree_map/btree_set에서 사용할 bidirectional iterator
+ * 노드와 노드 안의 위치(position)로 원소를 가리킨다.
+ * ++/--는 대부분 같은 leaf 안에서 position만 바꾸고, leaf의 끝에서만 부모/자식으로 이동한다.
+ *
+ * end()는 가장 오른쪽 leaf의 count 위치이다. (tree가 비어있으면 (NULL, 0))
+ * RBTree와 달리 원소가 노드 사이를 이동하므로, insert/erase 후에는 모든 iterator가 무효화된다.
+ */
+namespace ft
+{
+	template <typename T, typename Pointer = T*, typename Reference = T&, typename Node = ft::BTreeNode<T, 3> >
+	class BTreeIterator : public ft::iterator<ft::bidirectional_iterator_tag, T>
+	{
+		public :
+			typedef const T		value_type;
+			typedef Pointer		pointer;
+			typedef Reference	reference;
+			typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::difference_type	difference_type;
+			typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::iterator_category	iterator_category;
+			typedef Node node_type;
+		protected :
+			node_type* _node;
+			int _position;
+
+		public:
+			/**
+			 * @brief Construct a new BTreeIterator object
+			 */
+			//Default constructor
+			BTreeIterator(node_type* ptr = NULL, int position = 0) : _node(ptr), _position(position) {}
+			//Copy constructor는 컴파일러가 만든 것을 사용하고, iterator -> const_iterator 변환만 정의한다.
+			//template이므로 copy constructor로 취급되지 않는다. (const_iterator -> iterator는 U를 추론할 수 없어 막힌다)
+			template <typename U>
+			BTreeIterator(const BTreeIterator<U, U*, U&, Node>& copy) : _node(copy.base()), _position(copy.position()) {}
+			//Destructor
+			virtual ~BTreeIterator() {}
+			//Getter
+			node_type* const &base() const
+			{
+				return (this->_node);
+			}
+
+			int position() const
+			{
+				return (this->_position);
+			}
+
+			/**
+			 * @brief Operators
+			 */
+			reference operator*() const
+			{
+				return (this->_node->value(this->_position));
+			}
+			pointer operator->() const
+			{
+				return (this->_node->slot(this->_position));
+			}
+
+			//leaf 안에서는 position만 증가한다.
+			BTreeIterator& operator++()
+			{
+				if (this->_node->leaf && ++this->_position < this->_node->count)
+					return (*this);
+				increment_slow();
+				return (*this);
+			}
+
+			BTreeIterator operator++(int)
+			{
+				BTreeIterator tmp = *this;
+				++(*this);
+				return (tmp);
+			}
+
+			BTreeIterator& operator--()
+			{
+				if (this->_node->leaf && --this->_position >= 0)
+					return (*this);
+				decrement_slow();
+				return (*this);
+			}
+
+			BTreeIterator operator--(int)
+			{
+				BTreeIterator tmp = *this;
+				--(*this);
+				return (tmp);
+			}
+
+			/**
+			 * @brief Relational operators
+			 */
+			bool operator==(const BTreeIterator& iter)
+			{
+				return (this->_node == iter.base() && this->_position == iter.position());
+			}
+
+			bool operator!=(const BTreeIterator& iter)
+			{
+				return (!(*this == iter));
+			}
+
+		private:
+			void increment_slow()
+			{
+				if (this->_node->leaf)
+				{	// leaf의 끝 -> 자신이 마지막 자식이 아닌 조상까지 올라간다.
+					node_type* node = this->_node;
+					int position = this->_position;
+					while (this->_position == this->_node->count && this->_node->parent)
+					{
+						this->_position = this->_node->position;
+						this->_node = this->_node->parent;
+					}
+					// 더 큰 원소가 없으면 end()(가장 오른쪽 leaf의 count 위치)로 되돌린다.
+					if (this->_position == this->_node->count)
+					{
+						this->_node = node;
+						this->_position = position;
+					}
+				}
+				else
+				{	// 내부 노드 -> 오른쪽 자식 서브트리의 가장 왼쪽 leaf
+					this->_node = this->_node->child(this->_position + 1);
+					while (!this->_node->leaf)
+						this->_node = this->_node->child(0);
+					this->_position = 0;
+				}
+			}
+
+			void decrement_slow()
+			{
+				if (this->_node->leaf)
+				{	// leaf의 처음 -> 자신이 첫 자식이 아닌 조상까지 올라간다.
+					node_type* node = this->_node;
+					int position = this->_position;
+					while (this->_position < 0 && this->_node->parent)
+					{
+						this->_position = this->_node->position - 1;
+						this->_node = this->_node->parent;
+					}
+					if (this->_position < 0)
+					{
+						this->_node = node;
+						this->_position = position;
+					}
+				}
+				else
+				{	// 내부 노드 -> 왼쪽 자식 서브트리의 가장 오른쪽 leaf
+					this->_node = this->_node->child(this->_position);
+					while (!this->_node->leaf)
+						this->_node = this->_node->child(this->_node->count);
+					this->_position = this->_node->count - 1;
+				}
+			}
+	};
+} // namespace ft
+
+#endif
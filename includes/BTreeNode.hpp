@@ -0,0 +1,94 @@
+#ifndef BTREENODE_HPP
+# define BTREENODE_HPP
+
+#include <memory>
+#include <cstddef>
+
+/**
+ * @brief B-Tree Node
+ *
+ * RBTreeNode는 원소 하나마다 노드 하나를 할당하고 link 세 개를 따라 이동한다.
+ * B-Tree 노드는 정렬된 원소 여러 개를 한 노드의 연속된 slot에 저장한다.
+ * -> 탐색 시 노드 하나를 읽으면 cache line 몇 개 안에서 여러 key를 비교하고, 순회는 배열을 따라 읽는다.
+ *
+ * Node에 필요한 요소
+ * parent
+ * position	- parent의 몇 번째 자식인지
+ * count	- 저장된 원소의 수
+ * leaf		- leaf 노드인지
+ * slot		- 원소를 저장하는 raw memory (count개만 생성되어 있다)
+ *
+ * leaf 노드는 자식 포인터를 가지지 않는다. 내부 노드(BTreeInternalNode)만 count + 1개의 자식을 가진다.
+ * -> 대부분의 원소가 들어가는 leaf 노드에 자식 포인터 공간을 낭비하지 않는다.
+ *
+ * 한 노드의 slot 수는 노드 크기(NodeBytes, 기본 256 바이트 = cache line 4개)에 들어가는 원소 수로 정하고,
+ * 분할/병합이 가능하도록 최소 3개로 한다.
+ */
+namespace ft
+{
+	//NodeBytes 크기의 노드에 들어가는 T의 수
+	template < typename T, size_t NodeBytes >
+	struct BTreeSlots
+	{
+		static const size_t	header = 2 * sizeof(void*);
+		static const size_t	fit = (NodeBytes > header ? (NodeBytes - header) / sizeof(T) : 0);
+		static const size_t	value = (fit < 3 ? 3 : fit);
+	};
+
+	template < typename T, size_t Slots >
+	struct BTreeInternalNode;
+
+	template < typename T, size_t Slots >
+	struct BTreeNode {
+	public :
+		typedef T	value_type;
+		typedef BTreeNode*	node;
+		typedef BTreeInternalNode<T, Slots>	internal_node;
+		static const size_t	slots = Slots;
+
+		node	parent;
+		unsigned short	position;
+		unsigned short	count;
+		bool	leaf;
+		//원소는 필요할 때 allocator로 생성한다. union은 slot의 alignment를 맞추기 위한 것이다.
+		union {
+			char	bytes[sizeof(T) * Slots];
+			long double	align_ld;
+			long long	align_ll;
+			void*	align_ptr;
+		}	storage;
+
+		T* slot(size_t i)
+		{
+			return (reinterpret_cast<T*>(this->storage.bytes) + i);
+		}
+
+		T& value(size_t i)
+		{
+			return (*slot(i));
+		}
+
+		const T& value(size_t i) const
+		{
+			return (reinterpret_cast<const T*>(this->storage.bytes)[i]);
+		}
+
+		//내부 노드에서만 호출한다.
+		node& child(size_t i)
+		{
+			return (static_cast<internal_node*>(this)->children[i]);
+		}
+
+		node child(size_t i) const
+		{
+			return (static_cast<const internal_node*>(this)->children[i]);
+		}
+	};
+
+	template < typename T, size_t Slots >
+	struct BTreeInternalNode : public BTreeNode<T, Slots> {
+		BTreeNode<T, Slots>*	children[Slots + 1];
+	};
+} // namespace ft
+
+#endif
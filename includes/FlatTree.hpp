@@ -0,0 +1,364 @@
+#ifndef FLATTREE_HPP
+# define FLATTREE_HPP
+
+#include "vector.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief FlatTree class
+	 * flat_map/flat_set base - 정렬된 ft::vector
+	 *
+	 * 원소를 key 순서로 정렬된 연속된 배열 하나에 저장한다.
+	 * -> 노드 할당과 link가 없으므로 원소당 메모리가 원소 크기뿐이고, 탐색은 배열 위의 이진 탐색, 순회는 배열을 차례로 읽는다.
+	 * -> 대신 하나씩 insert/erase하면 뒤쪽 원소를 모두 옮기므로 O(N)이다.
+	 *
+	 * 한 번 만들고 조회만 하는 경우를 위한 컨테이너이다.
+	 * 원소를 여러 개 넣을 때는 range insert를 사용한다. (batch insert)
+	 * - 새 원소들만 (포인터로) 안정 정렬하고, 기존 배열과 한 번에 병합한다. -> O(M logM + N)
+	 * - 같은 key가 여러 번 들어오면 먼저 들어온 원소가, 이미 있는 key이면 기존 원소가 남는다. (map의 insert와 같다)
+	 *
+	 * 원소가 배열 안에서 이동하므로 insert/erase 후에는 모든 iterator가 무효화된다.
+	 * 원소는 복사 생성/소멸로만 옮기기 때문에 value_type이 pair<const Key, T>여도 된다.
+	 *
+	 * 시간복잡도
+	 * 탐색 = O(logN), 삽입/삭제 = O(N), range insert = O(M logM + N)
+	 *
+	 * @tparam T		value_type (pair of key and mapped_type)
+	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.
+	 */
+	template < typename T, typename Compare = ft::less<T>, typename Alloc = std::allocator<T> >
+	class FlatTree {
+		public :
+			/**
+			 * @brief Member types
+			 */
+			typedef T	value_type;
+			typedef Compare	value_comp;
+			typedef Alloc	allocator_type;
+			typedef size_t	size_type;
+			typedef ft::vector<T, Alloc>	vector_type;
+			typedef typename vector_type::iterator	iterator;
+			typedef typename vector_type::const_iterator	const_iterator;
+
+		private:
+			/**
+			 * @brief Member variables
+			 */
+			vector_type	_data;
+			value_comp	_comp;
+
+		public:
+			/**
+			 * @brief Member functions
+			 */
+			//Default constructor
+			explicit FlatTree(const value_comp& comp = value_comp(), const allocator_type& alloc = allocator_type())
+			: _data(alloc), _comp(comp) {}
+
+			//Copy constructor
+			FlatTree(const FlatTree& x) : _data(x._data), _comp(x._comp) {}
+
+			//Destructor
+			~FlatTree() {}
+
+#ifdef FT_CXX11
+			//Move constructor
+			//vector의 buffer를 그대로 가져온다. -> O(1)
+			FlatTree(FlatTree&& x) : _data(std::move(x._data)), _comp(x._comp) {}
+
+			//Move assignment operator
+			FlatTree& operator=(FlatTree&& x)
+			{
+				if (this != &x)
+				{
+					this->_data = std::move(x._data);
+					this->_comp = x._comp;
+				}
+				return (*this);
+			}
+#endif
+
+			//Assignment operator
+			FlatTree& operator=(const FlatTree& x)
+			{
+				if (this != &x)
+				{
+					this->_data = x._data;
+					this->_comp = x._comp;
+				}
+				return (*this);
+			}
+
+			//Iterators
+			iterator begin()
+			{
+				return (this->_data.begin());
+			}
+
+			const_iterator begin() const
+			{
+				return (this->_data.begin());
+			}
+
+			iterator end()
+			{
+				return (this->_data.end());
+			}
+
+			const_iterator end() const
+			{
+				return (this->_data.end());
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_data.empty());
+			}
+
+			size_type size() const
+			{
+				return (this->_data.size());
+			}
+
+			size_type max_size() const
+			{
+				return (this->_data.max_size());
+			}
+
+			size_type capacity() const
+			{
+				return (this->_data.capacity());
+			}
+
+			void reserve(size_type n)
+			{
+				this->_data.reserve(n);
+			}
+
+			//Element access
+			const value_type& operator[](size_type i) const
+			{
+				return (this->_data[i]);
+			}
+
+			value_type& operator[](size_type i)
+			{
+				return (this->_data[i]);
+			}
+
+			/**
+			 * @brief insert
+			 * 원소의 위치(index)와 삽입 여부를 반환한다.
+			 * c++11에서는 val을 배열에 넣을 때까지 그대로 넘긴다. (value_type&&이면 move)
+			 */
+#ifdef FT_CXX11
+			template <class V>
+			ft::pair<size_type, bool> insert(V&& val)
+#else
+			ft::pair<size_type, bool> insert(const value_type& val)
+#endif
+			{
+				size_type i = lower_bound(val);
+				if (i < size() && !this->_comp(val, this->_data[i]))
+					return (ft::make_pair(i, false));
+				return (ft::make_pair(insert_at(i, FT_FORWARD(V, val)), true));
+			}
+
+			//hint가 val이 들어갈 자리(앞 원소 < val < hint 원소)이면 이진 탐색 없이 삽입한다.
+#ifdef FT_CXX11
+			template <class V>
+			ft::pair<size_type, bool> insert(V&& val, size_type hint)
+#else
+			ft::pair<size_type, bool> insert(const value_type& val, size_type hint)
+#endif
+			{
+				if ((hint == 0 || this->_comp(this->_data[hint - 1], val))
+					&& (hint == size() || this->_comp(val, this->_data[hint])))
+					return (ft::make_pair(insert_at(hint, FT_FORWARD(V, val)), true));
+				return (insert(FT_FORWARD(V, val)));
+			}
+
+			/**
+			 * @brief insert_range (batch insert)
+			 * 1. 새 원소를 batch에 모은다.
+			 * 2. batch 원소의 포인터를 안정 정렬한다. -> 원소 자체는 옮기지 않는다.
+			 * 3. 기존 배열과 정렬된 batch를 병합하면서 새 배열을 한 번에 만든다. (중복 key는 앞의 것을 남긴다)
+			 */
+			template <typename InputIterator>
+			void insert_range(InputIterator first, InputIterator last)
+			{
+				vector_type batch;
+				for (; first != last; ++first)
+					batch.push_back(*first);
+				if (batch.empty())
+					return ;
+				ft::vector<const value_type*> order(batch.size());
+				for (size_type i = 0; i < batch.size(); ++i)
+					order[i] = &batch[i];
+				ft::vector<const value_type*> buffer(order.size() / 2 + 1);
+				sort(&order[0], &buffer[0], order.size());
+
+				vector_type merged(this->_data.get_allocator());
+				merged.reserve(size() + batch.size());
+				size_type i = 0;
+				for (size_type j = 0; j < order.size(); ++j)
+				{
+					const value_type& val = *order[j];
+					if (j > 0 && !this->_comp(*order[j - 1], val))
+						continue ;
+					while (i < size() && this->_comp(this->_data[i], val))
+						merged.push_back(this->_data[i++]);
+					if (i < size() && !this->_comp(val, this->_data[i]))
+						continue ;
+					merged.push_back(val);
+				}
+				while (i < size())
+					merged.push_back(this->_data[i++]);
+				this->_data.swap(merged);
+			}
+
+			//erase
+			void erase(size_type i)
+			{
+				this->_data.erase(this->_data.begin() + i);
+			}
+
+			template <typename K>
+			size_type erase_key(const K& k)
+			{
+				size_type i = find(k);
+				if (i == size())
+					return (0);
+				erase(i);
+				return (1);
+			}
+
+			//[first, last)를 한 번에 지운다. -> 뒤쪽 원소는 한 번만 옮긴다.
+			void erase_range(size_type first, size_type last)
+			{
+				this->_data.erase(this->_data.begin() + first, this->_data.begin() + last);
+			}
+
+			void swap(FlatTree& x)
+			{
+				this->_data.swap(x._data);
+				value_comp tmp = this->_comp;
+				this->_comp = x._comp;
+				x._comp = tmp;
+			}
+
+			void clear()
+			{
+				this->_data.clear();
+			}
+
+			//Operations
+			//k와 같은 원소의 index, 없으면 size()
+			template <typename K>
+			size_type find(const K& k) const
+			{
+				size_type i = lower_bound(k);
+				if (i < size() && !this->_comp(k, this->_data[i]))
+					return (i);
+				return (size());
+			}
+
+			//k보다 작지 않은 첫 원소의 index
+			template <typename K>
+			size_type lower_bound(const K& k) const
+			{
+				size_type lo = 0;
+				size_type hi = size();
+				while (lo < hi)
+				{
+					size_type mid = lo + (hi - lo) / 2;
+					if (this->_comp(this->_data[mid], k))
+						lo = mid + 1;
+					else
+						hi = mid;
+				}
+				return (lo);
+			}
+
+			//k보다 큰 첫 원소의 index
+			template <typename K>
+			size_type upper_bound(const K& k) const
+			{
+				size_type lo = 0;
+				size_type hi = size();
+				while (lo < hi)
+				{
+					size_type mid = lo + (hi - lo) / 2;
+					if (this->_comp(k, this->_data[mid]))
+						hi = mid;
+					else
+						lo = mid + 1;
+				}
+				return (lo);
+			}
+
+			//Allocator
+			allocator_type get_allocator() const
+			{
+				return (this->_data.get_allocator());
+			}
+
+		private:
+			//vector의 insert가 growth factor만큼 늘리므로 하나씩 삽입해도 재할당은 O(logN)번
+#ifdef FT_CXX11
+			template <class V>
+			size_type insert_at(size_type i, V&& val)
+#else
+			size_type insert_at(size_type i, const value_type& val)
+#endif
+			{
+				this->_data.insert(this->_data.begin() + i, FT_FORWARD(V, val));
+				return (i);
+			}
+
+			/**
+			 * @brief sort
+			 * 원소 포인터 배열 [a, a + n)을 원소 기준으로 안정 정렬한다. (merge sort, buffer는 n / 2 + 1개)
+			 * 작은 구간은 insertion sort로, 이미 순서대로인 두 구간은 병합하지 않는다. -> 정렬된 입력은 O(N)
+			 */
+			void sort(const value_type** a, const value_type** buffer, size_type n) const
+			{
+				if (n <= 16)
+				{
+					for (size_type i = 1; i < n; ++i)
+					{
+						const value_type* tmp = a[i];
+						size_type j = i;
+						for (; j > 0 && this->_comp(*tmp, *a[j - 1]); --j)
+							a[j] = a[j - 1];
+						a[j] = tmp;
+					}
+					return ;
+				}
+				size_type half = n / 2;
+				sort(a, buffer, half);
+				sort(a + half, buffer, n - half);
+				if (!this->_comp(*a[half], *a[half - 1]))
+					return ;
+				for (size_type i = 0; i < half; ++i)
+					buffer[i] = a[i];
+				size_type i = 0;
+				size_type j = half;
+				size_type k = 0;
+				while (i < half && j < n)
+				{
+					if (this->_comp(*a[j], *buffer[i]))
+						a[k++] = a[j++];
+					else
+						a[k++] = buffer[i++];
+				}
+				while (i < half)
+					a[k++] = buffer[i++];
+			}
+	};
+} // namespace ft
+
+#endif
@@ -0,0 +1,262 @@
+#ifndef HASHGROUP_HPP
+# define HASHGROUP_HPP
+
+#include <cstring>
+#include <cstddef>
+
+#if !defined(FT_HASH_NO_SIMD) && defined(__AVX2__) && defined(FT_HASH_AVX2)
+# define FT_HASH_GROUP_AVX2
+# include <immintrin.h>
+#elif !defined(FT_HASH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+# define FT_HASH_GROUP_SSE2
+# include <emmintrin.h>
+#endif
+
+/**
+ * @brief Hash Group
+ *
+ * HashTable(open addressing, SwissTable 방식)의 control byte와 group 탐색.
+ *
+ * slot마다 1바이트 control byte를 두고, 탐색은 control byte 배열만 먼저 본다.
+ * full		- 0 ~ 127, 원소 hash의 하위 7비트(H2)
+ * empty	- -128 (0b10000000)
+ * deleted	- -2   (0b11111110), 지워진 자리(tombstone). 탐색은 계속 진행한다.
+ * sentinel	- -1   (0b11111111), control byte 배열의 끝. iterator가 여기서 멈춘다.
+ *
+ * group은 연속된 control byte Width개를 한 번에 읽어 비교한다.
+ * -> H2가 같은 자리만 key를 비교하므로, 대부분의 miss는 key를 읽지 않고 끝난다.
+ *
+ * HashGroup은 compile time에 고른다.
+ * AVX2	- 32바이트, FT_HASH_AVX2를 정의하고 -mavx2로 compile한 경우만 (선택)
+ * SSE2	- 16바이트, x86-64의 기본
+ * portable	- 8바이트, 64비트 정수의 비트 연산 (little endian). SIMD가 없거나 FT_HASH_NO_SIMD를 정의한 경우
+ */
+namespace ft
+{
+	typedef signed char	hash_ctrl;
+
+	struct HashCtrl
+	{
+		static const hash_ctrl	empty = -128;
+		static const hash_ctrl	deleted = -2;
+		static const hash_ctrl	sentinel = -1;
+
+		static bool is_full(hash_ctrl c)
+		{
+			return (c >= 0);
+		}
+
+		static bool is_empty_or_deleted(hash_ctrl c)
+		{
+			return (c < sentinel);
+		}
+	};
+
+	//가장 낮은/높은 set bit의 위치
+	inline int hash_ctz(unsigned long long x)
+	{
+#if defined(__GNUC__)
+		return (__builtin_ctzll(x));
+#else
+		int n = 0;
+		while (!(x & 1))
+		{
+			x >>= 1;
+			++n;
+		}
+		return (n);
+#endif
+	}
+
+	inline int hash_clz(unsigned long long x)
+	{
+#if defined(__GNUC__)
+		return (__builtin_clzll(x));
+#else
+		int n = 0;
+		while (!(x & (1ULL << 63)))
+		{
+			x <<= 1;
+			++n;
+		}
+		return (n);
+#endif
+	}
+
+	/**
+	 * @brief HashBitMask
+	 * group 비교 결과. 일치한 control byte마다 비트가 하나 켜져 있다.
+	 * 한 바이트가 2^Shift 비트를 차지한다. (portable group은 바이트의 최상위 비트, Shift = 3)
+	 */
+	template < size_t Width, int Shift >
+	class HashBitMask
+	{
+		private:
+			unsigned long long	_mask;
+
+		public:
+			explicit HashBitMask(unsigned long long mask) : _mask(mask) {}
+
+			operator bool() const
+			{
+				return (this->_mask != 0);
+			}
+
+			//일치한 가장 앞 control byte의 위치
+			size_t lowest() const
+			{
+				return (hash_ctz(this->_mask) >> Shift);
+			}
+
+			void clear_lowest()
+			{
+				this->_mask &= this->_mask - 1;
+			}
+
+			//앞/뒤에서부터 일치하지 않는 control byte의 수 (mask가 0이 아닐 때만)
+			size_t trailing_zeros() const
+			{
+				return (hash_ctz(this->_mask) >> Shift);
+			}
+
+			size_t leading_zeros() const
+			{
+				return ((hash_clz(this->_mask) - (64 - (Width << Shift))) >> Shift);
+			}
+	};
+
+	/**
+	 * @brief HashGroupPortable
+	 * control byte 8개를 unsigned long long 하나로 읽어 비트 연산으로 비교한다.
+	 * match는 실제로 일치한 바이트 뒤에서 드물게 false positive가 있을 수 있다. -> 호출자가 key를 비교하므로 괜찮다.
+	 */
+	class HashGroupPortable
+	{
+		public:
+			static const size_t	width = 8;
+			typedef HashBitMask<8, 3>	bitmask;
+
+		private:
+			static const unsigned long long	lsbs = 0x0101010101010101ULL;
+			static const unsigned long long	msbs = 0x8080808080808080ULL;
+			unsigned long long	_ctrl;
+
+		public:
+			explicit HashGroupPortable(const hash_ctrl* pos)
+			{
+				std::memcpy(&this->_ctrl, pos, sizeof(this->_ctrl));
+			}
+
+			static const char* name()
+			{
+				return ("portable");
+			}
+
+			//control byte가 h2인 위치
+			bitmask match(hash_ctrl h2) const
+			{
+				unsigned long long x = this->_ctrl ^ (lsbs * static_cast<unsigned char>(h2));
+				return (bitmask((x - lsbs) & ~x & msbs));
+			}
+
+			//empty: 최상위 비트가 켜져 있고 1번 비트가 꺼져 있다.
+			bitmask mask_empty() const
+			{
+				return (bitmask(this->_ctrl & ~(this->_ctrl << 6) & msbs));
+			}
+
+			//empty/deleted: 최상위 비트가 켜져 있고 0번 비트가 꺼져 있다. (sentinel 제외)
+			bitmask mask_empty_or_deleted() const
+			{
+				return (bitmask(this->_ctrl & ~(this->_ctrl << 7) & msbs));
+			}
+	};
+
+#if defined(FT_HASH_GROUP_SSE2) || defined(FT_HASH_GROUP_AVX2)
+	/**
+	 * @brief HashGroupSse2
+	 * control byte 16개를 한 번에 비교한다. 일치한 바이트마다 movemask의 비트가 하나 켜진다.
+	 */
+	class HashGroupSse2
+	{
+		public:
+			static const size_t	width = 16;
+			typedef HashBitMask<16, 0>	bitmask;
+
+		private:
+			__m128i	_ctrl;
+
+		public:
+			explicit HashGroupSse2(const hash_ctrl* pos) : _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+			static const char* name()
+			{
+				return ("sse2");
+			}
+
+			bitmask match(hash_ctrl h2) const
+			{
+				return (bitmask(static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), this->_ctrl)))));
+			}
+
+			bitmask mask_empty() const
+			{
+				return (bitmask(static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(HashCtrl::empty), this->_ctrl)))));
+			}
+
+			//sentinel보다 작은 값 (signed 비교)
+			bitmask mask_empty_or_deleted() const
+			{
+				return (bitmask(static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(HashCtrl::sentinel), this->_ctrl)))));
+			}
+	};
+#endif
+
+#if defined(FT_HASH_GROUP_AVX2)
+	/**
+	 * @brief HashGroupAvx2
+	 * control byte 32개를 한 번에 비교한다.
+	 * group이 넓으면 높은 load factor에서 probe 횟수가 줄지만, 작은 table에서는 control byte 배열이 Width만큼 커진다.
+	 */
+	class HashGroupAvx2
+	{
+		public:
+			static const size_t	width = 32;
+			typedef HashBitMask<32, 0>	bitmask;
+
+		private:
+			__m256i	_ctrl;
+
+		public:
+			explicit HashGroupAvx2(const hash_ctrl* pos) : _ctrl(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos))) {}
+
+			static const char* name()
+			{
+				return ("avx2");
+			}
+
+			bitmask match(hash_ctrl h2) const
+			{
+				return (bitmask(static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(h2), this->_ctrl)))));
+			}
+
+			bitmask mask_empty() const
+			{
+				return (bitmask(static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(HashCtrl::empty), this->_ctrl)))));
+			}
+
+			bitmask mask_empty_or_deleted() const
+			{
+				return (bitmask(static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8(HashCtrl::sentinel), this->_ctrl)))));
+			}
+	};
+
+	typedef HashGroupAvx2	HashGroup;
+#elif defined(FT_HASH_GROUP_SSE2)
+	typedef HashGroupSse2	HashGroup;
+#else
+	typedef HashGroupPortable	HashGroup;
+#endif
+} // namespace ft
+
+#endif
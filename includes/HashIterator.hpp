@@ -0,0 +1,107 @@
+#ifndef HASHITERATOR_HPP
+# define HASHITERATOR_HPP
+
+#include "utils.hpp"
+#include "HashGroup.hpp"
+
+/**
+ * @brief Hash Iterator
+ *
+ * unordered_map/unordered_set에서 사용할 forward iterator
+ * control byte와 slot을 함께 가리키고, ++는 다음 full control byte까지 건너뛴다.
+ * control byte 배열의 끝에는 sentinel이 있으므로 따로 범위를 검사하지 않는다.
+ *
+ * end()는 sentinel의 위치이다. (table이 비어있으면 (NULL, NULL))
+ * 원소는 rehash 때만 이동하므로, insert가 rehash를 일으키지 않으면 iterator는 유효하다.
+ */
+namespace ft
+{
+	template <typename T, typename Pointer = T*, typename Reference = T&>
+	class HashIterator : public ft::iterator<ft::forward_iterator_tag, T>
+	{
+		public :
+			typedef const T		value_type;
+			typedef Pointer		pointer;
+			typedef Reference	reference;
+			typedef typename ft::iterator<ft::forward_iterator_tag, T>::difference_type	difference_type;
+			typedef typename ft::iterator<ft::forward_iterator_tag, T>::iterator_category	iterator_category;
+		protected :
+			const hash_ctrl* _ctrl;
+			T* _slot;
+
+		public:
+			/**
+			 * @brief Construct a new HashIterator object
+			 */
+			//Default constructor
+			HashIterator(const hash_ctrl* ctrl = NULL, T* slot = NULL) : _ctrl(ctrl), _slot(slot) {}
+			//Copy constructor는 컴파일러가 만든 것을 사용하고, iterator -> const_iterator 변환만 정의한다.
+			//template이므로 copy constructor로 취급되지 않는다. (const_iterator -> iterator는 U를 추론할 수 없어 막힌다)
+			template <typename U>
+			HashIterator(const HashIterator<U, U*, U&>& copy) : _ctrl(copy.ctrl()), _slot(copy.base()) {}
+			//Destructor
+			virtual ~HashIterator() {}
+			//Getter
+			T* base() const
+			{
+				return (this->_slot);
+			}
+
+			const hash_ctrl* ctrl() const
+			{
+				return (this->_ctrl);
+			}
+
+			/**
+			 * @brief Operators
+			 */
+			reference operator*() const
+			{
+				return (*this->_slot);
+			}
+			pointer operator->() const
+			{
+				return (this->_slot);
+			}
+
+			HashIterator& operator++()
+			{
+				++this->_ctrl;
+				++this->_slot;
+				skip_empty_or_deleted();
+				return (*this);
+			}
+
+			HashIterator operator++(int)
+			{
+				HashIterator tmp = *this;
+				++(*this);
+				return (tmp);
+			}
+
+			//빈 자리를 건너뛰어 다음 원소(또는 sentinel)로 이동한다.
+			void skip_empty_or_deleted()
+			{
+				while (HashCtrl::is_empty_or_deleted(*this->_ctrl))
+				{
+					++this->_ctrl;
+					++this->_slot;
+				}
+			}
+
+			/**
+			 * @brief Relational operators
+			 */
+			bool operator==(const HashIterator& iter) const
+			{
+				return (this->_ctrl == iter.ctrl());
+			}
+
+			bool operator!=(const HashIterator& iter) const
+			{
+				return (!(*this == iter));
+			}
+	};
+} // namespace ft
+
+#endif
@@ -0,0 +1,495 @@
+#ifndef HASHTABLE_HPP
+# define HASHTABLE_HPP
+
+#include <memory>
+#include <cstring>
+#include "HashIterator.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief HashTable class
+	 * unordered_map/unordered_set base - open addressing hash table (SwissTable 방식)
+	 *
+	 * RBTree는 탐색마다 O(logN)개의 노드를 따라가고, 노드마다 다른 cache line을 읽는다.
+	 * HashTable은 원소를 slot 배열 하나에, slot마다 control byte 하나를 별도 배열에 저장한다.
+	 * -> 노드 할당이 없고, 탐색은 control byte group(HashGroup)을 읽어 H2가 같은 slot의 key만 비교한다.
+	 *
+	 * hash 값 h (hasher 결과를 한 번 더 섞은 값)
+	 * H1 = h >> 7		- 탐색을 시작할 group의 위치
+	 * H2 = h & 0x7F	- control byte에 저장하는 값
+	 *
+	 * capacity(slot 수)는 항상 2^k - 1이다. 탐색은 H1 & capacity에서 시작해 group 단위로 이동한다. (quadratic probing)
+	 * control byte 배열은 capacity + Width 바이트이다.
+	 * [0, capacity) slot의 control byte | sentinel | 앞쪽 Width - 1개의 복사본
+	 * -> 끝 근처에서 group을 읽어도 범위를 검사하지 않고 앞쪽으로 이어진다.
+	 *
+	 * 삭제 - slot을 비우고 control byte를 deleted(tombstone)로 표시한다.
+	 *        양쪽 group에 empty가 있어 이 slot을 지나쳐 간 탐색이 없었다면 바로 empty로 되돌린다.
+	 * 증가 - 원소 + tombstone 수가 capacity * max_load_factor에 닿으면 rehash한다.
+	 *        tombstone이 많으면 같은 capacity로, 아니면 두 배로 다시 만든다.
+	 *
+	 * 원소는 rehash 때만 이동한다. -> rehash가 일어나면 모든 iterator가 무효화된다.
+	 *
+	 * 시간복잡도
+	 * 삽입/삭제/탐색 = 평균 O(1)
+	 *
+	 * @tparam T		value_type (pair of key and mapped_type)
+	 * @tparam Hash		value_type과 key를 받아 size_t를 반환하는 함수 객체
+	 * @tparam Equal	(value_type, key)를 받아 key가 같은지 반환하는 함수 객체
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.
+	 * @tparam Group	control byte group 구현. 기본값은 compile time에 고른 SIMD group이다. (HashGroup.hpp)
+	 */
+	template < typename T, typename Hash, typename Equal, typename Alloc = std::allocator<T>, typename Group = ft::HashGroup >
+	class HashTable {
+		public :
+			/**
+			 * @brief Member types
+			 */
+			typedef T	value_type;
+			typedef T*	pointer;
+			typedef const T*	const_pointer;
+			typedef T&	reference;
+			typedef const T&	const_reference;
+			typedef Hash	value_hash;
+			typedef Equal	value_equal;
+			typedef Alloc	allocator_type;
+			typedef size_t	size_type;
+			typedef Group	group;
+			typedef typename ft::HashIterator<T, T*, T&>	iterator;
+			typedef typename ft::HashIterator<T, const T*, const T&>	const_iterator;
+			typedef typename Alloc::template rebind<hash_ctrl>::other	ctrl_allocator_type;
+
+		private:
+			/**
+			 * @brief Member variables
+			 */
+			hash_ctrl*	_ctrl;
+			pointer		_slots;
+			size_type	_size;
+			size_type	_capacity;
+			//rehash 없이 더 넣을 수 있는 원소 수 (tombstone은 자리를 차지한다)
+			size_type	_growth_left;
+			float		_max_load_factor;
+			value_hash	_hash;
+			value_equal	_eq;
+			allocator_type	_alloc;
+			ctrl_allocator_type	_ctrl_alloc;
+
+		public:
+			/**
+			 * @brief Member functions
+			 */
+			//Default constructor
+			explicit HashTable(const value_hash& hash = value_hash(), const value_equal& eq = value_equal(), const allocator_type& alloc = allocator_type())
+			: _ctrl(NULL), _slots(NULL), _size(0), _capacity(0), _growth_left(0), _max_load_factor(0.875f),
+			_hash(hash), _eq(eq), _alloc(alloc), _ctrl_alloc(alloc) {}
+
+			//Copy constructor
+			//원소 수에 맞는 capacity로 만들고, 중복이 없으므로 탐색 없이 빈 slot에 바로 넣는다.
+			HashTable(const HashTable& x)
+			: _ctrl(NULL), _slots(NULL), _size(0), _capacity(0), _growth_left(0), _max_load_factor(x._max_load_factor),
+			_hash(x._hash), _eq(x._eq), _alloc(x._alloc), _ctrl_alloc(x._ctrl_alloc)
+			{
+				reserve(x._size);
+				for (const_iterator it = x.begin(); it != x.end(); ++it)
+					insert_new(hash_of(*it), *it);
+			}
+
+			//Destructor
+			~HashTable()
+			{
+				release();
+			}
+
+			//Assignment operator
+			HashTable& operator=(const HashTable& x)
+			{
+				if (this != &x)
+				{
+					HashTable tmp(x);
+					swap(tmp);
+				}
+				return (*this);
+			}
+
+			//Iterators
+			iterator begin()
+			{
+				iterator it = end();
+				if (this->_size)
+				{
+					it = iterator(this->_ctrl, this->_slots);
+					it.skip_empty_or_deleted();
+				}
+				return (it);
+			}
+
+			const_iterator begin() const
+			{
+				const_iterator it = end();
+				if (this->_size)
+				{
+					it = const_iterator(this->_ctrl, this->_slots);
+					it.skip_empty_or_deleted();
+				}
+				return (it);
+			}
+
+			iterator end()
+			{
+				return (iterator_at(this->_capacity));
+			}
+
+			const_iterator end() const
+			{
+				return (const_iterator(iterator_at(this->_capacity)));
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_size == 0);
+			}
+
+			size_type size() const
+			{
+				return (this->_size);
+			}
+
+			size_type max_size() const
+			{
+				return (this->_alloc.max_size());
+			}
+
+			size_type capacity() const
+			{
+				return (this->_capacity);
+			}
+
+			/**
+			 * @brief insert
+			 * 이미 있으면 그 원소를, 없으면 새로 넣은 원소를 가리키는 iterator와 삽입 여부를 반환한다.
+			 */
+			ft::pair<iterator, bool> insert(const value_type& val)
+			{
+				size_t h = hash_of(val);
+				size_type i = find_index(val, h);
+				if (i != this->_capacity)
+					return (ft::make_pair(iterator_at(i), false));
+				return (ft::make_pair(iterator_at(insert_new(h, val)), true));
+			}
+
+			//erase
+			void erase(const_iterator position)
+			{
+				erase_at(position.base() - this->_slots);
+			}
+
+			template <typename K>
+			size_type erase_key(const K& k)
+			{
+				size_type i = find_index(k, hash_of(k));
+				if (i == this->_capacity)
+					return (0);
+				erase_at(i);
+				return (1);
+			}
+
+			void swap(HashTable& x)
+			{
+				swap_value(this->_ctrl, x._ctrl);
+				swap_value(this->_slots, x._slots);
+				swap_value(this->_size, x._size);
+				swap_value(this->_capacity, x._capacity);
+				swap_value(this->_growth_left, x._growth_left);
+				swap_value(this->_max_load_factor, x._max_load_factor);
+				swap_value(this->_hash, x._hash);
+				swap_value(this->_eq, x._eq);
+				swap_value(this->_alloc, x._alloc);
+				swap_value(this->_ctrl_alloc, x._ctrl_alloc);
+			}
+
+			//원소만 지우고 capacity는 유지한다.
+			void clear()
+			{
+				if (!this->_capacity)
+					return ;
+				destroy_values();
+				reset_ctrl();
+				this->_size = 0;
+				this->_growth_left = growth_limit(this->_capacity);
+			}
+
+			//Operations
+			template <typename K>
+			iterator find(const K& k)
+			{
+				return (iterator_at(find_index(k, hash_of(k))));
+			}
+
+			template <typename K>
+			const_iterator find(const K& k) const
+			{
+				return (const_iterator(iterator_at(find_index(k, hash_of(k)))));
+			}
+
+			//Hash policy
+			float load_factor() const
+			{
+				return (this->_capacity ? static_cast<float>(this->_size) / this->_capacity : 0.0f);
+			}
+
+			float max_load_factor() const
+			{
+				return (this->_max_load_factor);
+			}
+
+			//open addressing이므로 1보다 클 수 없다. 바뀐 값에 맞춰 다시 만든다.
+			void max_load_factor(float ml)
+			{
+				if (ml <= 0.0f)
+					return ;
+				this->_max_load_factor = (ml < 1.0f ? ml : 1.0f);
+				if (this->_capacity)
+					resize(capacity_for(this->_size, this->_capacity));
+			}
+
+			//slot 수를 n 이상으로 한다. 원소가 없고 n이 0이면 메모리를 반환한다.
+			void rehash(size_type n)
+			{
+				if (n == 0 && this->_size == 0)
+				{
+					release();
+					return ;
+				}
+				size_type capacity = capacity_for(this->_size, n);
+				if (capacity != this->_capacity || this->_size + this->_growth_left != growth_limit(capacity))
+					resize(capacity);
+			}
+
+			//원소 n개를 rehash 없이 넣을 수 있도록 한다.
+			void reserve(size_type n)
+			{
+				if (n > this->_size + this->_growth_left)
+					resize(capacity_for(n, this->_capacity));
+			}
+
+			//Allocator
+			allocator_type get_allocator() const
+			{
+				return (this->_alloc);
+			}
+
+		private:
+			template <typename U>
+			static void swap_value(U& a, U& b)
+			{
+				U tmp = a;
+				a = b;
+				b = tmp;
+			}
+
+			//hasher의 결과를 섞는다. -> 정수 key를 그대로 반환하는 hasher도 H1/H2가 고르게 나온다.
+			template <typename K>
+			size_t hash_of(const K& k) const
+			{
+				size_t h = this->_hash(k);
+				h ^= h >> (sizeof(size_t) * 4);
+				h *= static_cast<size_t>(0xff51afd7ed558ccdULL);
+				h ^= h >> (sizeof(size_t) * 4);
+				return (h);
+			}
+
+			static size_type h1(size_t h)
+			{
+				return (h >> 7);
+			}
+
+			static hash_ctrl h2(size_t h)
+			{
+				return (static_cast<hash_ctrl>(h & 0x7F));
+			}
+
+			iterator iterator_at(size_type i) const
+			{
+				if (!this->_capacity)
+					return (iterator());
+				return (iterator(this->_ctrl + i, this->_slots + i));
+			}
+
+			//capacity c에 넣을 수 있는 최대 원소 수. 탐색이 끝나도록 empty slot을 최소 하나 남긴다.
+			size_type growth_limit(size_type c) const
+			{
+				size_type limit = static_cast<size_type>(c * this->_max_load_factor);
+				return (limit < c ? limit : c - 1);
+			}
+
+			//n개를 넣을 수 있고 min_capacity 이상인 가장 작은 2^k - 1
+			size_type capacity_for(size_type n, size_type min_capacity) const
+			{
+				size_type c = 1;
+				while (c < min_capacity || growth_limit(c) < n)
+					c = c * 2 + 1;
+				return (c);
+			}
+
+			/**
+			 * @brief find_index
+			 * H1의 group부터 H2가 같은 slot의 key를 비교한다. group에 empty가 있으면 더 찾지 않는다.
+			 * 없으면 capacity를 반환한다.
+			 */
+			template <typename K>
+			size_type find_index(const K& k, size_t h) const
+			{
+				if (!this->_capacity)
+					return (0);
+				size_type offset = h1(h) & this->_capacity;
+				size_type step = 0;
+				while (true)
+				{
+					group g(this->_ctrl + offset);
+					for (typename group::bitmask m = g.match(h2(h)); m; m.clear_lowest())
+					{
+						size_type i = (offset + m.lowest()) & this->_capacity;
+						if (this->_eq(this->_slots[i], k))
+							return (i);
+					}
+					if (g.mask_empty())
+						return (this->_capacity);
+					step += group::width;
+					offset = (offset + step) & this->_capacity;
+				}
+			}
+
+			//h의 탐색 경로에서 처음 나오는 empty/deleted slot
+			size_type find_first_non_full(size_t h) const
+			{
+				size_type offset = h1(h) & this->_capacity;
+				size_type step = 0;
+				while (true)
+				{
+					typename group::bitmask m = group(this->_ctrl + offset).mask_empty_or_deleted();
+					if (m)
+						return ((offset + m.lowest()) & this->_capacity);
+					step += group::width;
+					offset = (offset + step) & this->_capacity;
+				}
+			}
+
+			//control byte와 (앞쪽 Width - 1개이면) 끝의 복사본을 함께 바꾼다.
+			void set_ctrl(size_type i, hash_ctrl c)
+			{
+				this->_ctrl[i] = c;
+				this->_ctrl[((i - (group::width - 1)) & this->_capacity) + ((group::width - 1) & this->_capacity)] = c;
+			}
+
+			//key가 없는 것을 확인한 뒤 호출한다. 필요하면 rehash한 뒤 빈 slot에 넣는다.
+			size_type insert_new(size_t h, const value_type& val)
+			{
+				size_type i = 0;
+				if (this->_capacity)
+					i = find_first_non_full(h);
+				if (this->_growth_left == 0 && (!this->_capacity || this->_ctrl[i] != HashCtrl::deleted))
+				{
+					rehash_and_grow();
+					i = find_first_non_full(h);
+				}
+				this->_alloc.construct(this->_slots + i, val);
+				if (this->_ctrl[i] == HashCtrl::empty)
+					--this->_growth_left;
+				set_ctrl(i, h2(h));
+				++this->_size;
+				return (i);
+			}
+
+			void erase_at(size_type i)
+			{
+				this->_alloc.destroy(this->_slots + i);
+				--this->_size;
+				//i 앞뒤로 Width개 안에 empty가 있으면 i를 지나쳐 간 탐색이 없다. -> tombstone이 필요 없다.
+				size_type before = (i - group::width) & this->_capacity;
+				typename group::bitmask empty_after = group(this->_ctrl + i).mask_empty();
+				typename group::bitmask empty_before = group(this->_ctrl + before).mask_empty();
+				if (empty_before && empty_after && empty_after.trailing_zeros() + empty_before.leading_zeros() < group::width)
+				{
+					set_ctrl(i, HashCtrl::empty);
+					++this->_growth_left;
+				}
+				else
+					set_ctrl(i, HashCtrl::deleted);
+			}
+
+			//tombstone이 growth limit의 7/32 이상이면 같은 capacity로 정리만 한다.
+			void rehash_and_grow()
+			{
+				if (this->_capacity > group::width && this->_size * 32 <= growth_limit(this->_capacity) * 25)
+					resize(this->_capacity);
+				else
+					resize(capacity_for(this->_size + 1, this->_capacity * 2 + 1));
+			}
+
+			/**
+			 * @brief resize
+			 * capacity의 새 배열을 만들고 원소를 옮긴다. tombstone은 모두 사라진다.
+			 */
+			void resize(size_type capacity)
+			{
+				hash_ctrl* old_ctrl = this->_ctrl;
+				pointer old_slots = this->_slots;
+				size_type old_capacity = this->_capacity;
+
+				this->_capacity = capacity;
+				this->_ctrl = this->_ctrl_alloc.allocate(capacity + group::width);
+				this->_slots = this->_alloc.allocate(capacity);
+				reset_ctrl();
+				for (size_type i = 0; i < old_capacity; ++i)
+				{
+					if (!HashCtrl::is_full(old_ctrl[i]))
+						continue ;
+					size_t h = hash_of(old_slots[i]);
+					size_type j = find_first_non_full(h);
+					this->_alloc.construct(this->_slots + j, old_slots[i]);
+					this->_alloc.destroy(old_slots + i);
+					set_ctrl(j, h2(h));
+				}
+				this->_growth_left = growth_limit(capacity) - this->_size;
+				if (old_capacity)
+				{
+					this->_ctrl_alloc.deallocate(old_ctrl, old_capacity + group::width);
+					this->_alloc.deallocate(old_slots, old_capacity);
+				}
+			}
+
+			void reset_ctrl()
+			{
+				std::memset(this->_ctrl, static_cast<unsigned char>(HashCtrl::empty), this->_capacity + group::width);
+				this->_ctrl[this->_capacity] = HashCtrl::sentinel;
+			}
+
+			void destroy_values()
+			{
+				for (size_type i = 0; i < this->_capacity; ++i)
+				{
+					if (HashCtrl::is_full(this->_ctrl[i]))
+						this->_alloc.destroy(this->_slots + i);
+				}
+			}
+
+			void release()
+			{
+				if (!this->_capacity)
+					return ;
+				destroy_values();
+				this->_ctrl_alloc.deallocate(this->_ctrl, this->_capacity + group::width);
+				this->_alloc.deallocate(this->_slots, this->_capacity);
+				this->_ctrl = NULL;
+				this->_slots = NULL;
+				this->_size = 0;
+				this->_capacity = 0;
+				this->_growth_left = 0;
+			}
+	};
+} // namespace ft
+
+#endif
@@ -0,0 +1,227 @@
+#ifndef NODEPOOL_HPP
+# define NODEPOOL_HPP
+
+#include <memory>
+#include "utils.hpp"
+
+/**
+ * @brief node pool
+ *
+ * RBTree가 노드를 할당/해제할 때 사용하는 저장소.
+ *
+ * 기본(Pooled = false)은 노드마다 allocator에 allocate(1)/deallocate(1)을 그대로 전달한다.
+ * map/set에 ft::pool_allocator를 넘기면(Pooled = true) slab 방식으로 동작한다.
+ * - allocator에서 노드 여러 개 크기의 chunk를 한 번에 받아 앞에서부터 잘라 쓴다. chunk 크기는 두 배씩 커진다.
+ * - 해제된 노드는 tree마다 가지고 있는 free list에 넣어두고 다음 할당에 재사용한다.
+ * - clear/소멸 시에는 노드를 하나씩 해제하지 않고 chunk 단위로 한 번에 돌려준다.
+ * -> insert/erase가 반복되는 상황에서 malloc/free 호출이 사라지고, 노드들이 연속된 메모리에 모인다.
+ */
+namespace ft
+{
+	/**
+	 * @brief pool_allocator
+	 * std::allocator와 동일하게 동작하는 allocator.
+	 * map/set/RBTree에 넘기면 tree가 노드를 slab pool에서 할당한다.
+	 * allocator 자체는 상태를 가지지 않고, pool은 tree마다 따로 가진다.
+	 */
+	template <typename T>
+	class pool_allocator : public std::allocator<T>
+	{
+		public:
+			template <typename U>
+			struct rebind
+			{
+				typedef pool_allocator<U> other;
+			};
+
+			//copy/assign/소멸자는 컴파일러가 만든 것을 사용한다. (c++11 -Wdeprecated-copy)
+			pool_allocator() throw() : std::allocator<T>() {}
+			template <typename U>
+			pool_allocator(const pool_allocator<U>&) throw() : std::allocator<T>() {}
+	};
+
+	//allocator가 pool_allocator인지 판별한다.
+	template <typename Alloc>
+	struct is_pool_allocator : public integral_traits<false, bool> {};
+
+	template <typename T>
+	struct is_pool_allocator< pool_allocator<T> > : public integral_traits<true, bool> {};
+
+	//노드마다 allocator를 그대로 사용한다.
+	template <typename Node, typename Alloc, bool Pooled = false>
+	class node_pool
+	{
+		public:
+			typedef Alloc	allocator_type;
+			typedef typename allocator_type::size_type	size_type;
+
+		private:
+			allocator_type	_alloc;
+
+		public:
+			explicit node_pool(const allocator_type& alloc = allocator_type()) : _alloc(alloc) {}
+			node_pool(const node_pool& other) : _alloc(other._alloc) {}
+
+			Node* allocate()
+			{
+				return (this->_alloc.allocate(1));
+			}
+
+			void deallocate(Node* node)
+			{
+				this->_alloc.deallocate(node, 1);
+			}
+
+			//노드를 하나씩 해제하므로 한 번에 돌려줄 것이 없다.
+			void release() {}
+
+			size_type max_size() const
+			{
+				return (this->_alloc.max_size());
+			}
+
+			allocator_type& get_allocator()
+			{
+				return (this->_alloc);
+			}
+
+			void swap(node_pool& other)
+			{
+				allocator_type tmp(this->_alloc);
+				this->_alloc = other._alloc;
+				other._alloc = tmp;
+			}
+
+		private:
+			node_pool& operator=(const node_pool&);
+	};
+
+	//slab pool
+	template <typename Node, typename Alloc>
+	class node_pool<Node, Alloc, true>
+	{
+		public:
+			typedef Alloc	allocator_type;
+			typedef typename allocator_type::size_type	size_type;
+
+		private:
+			//해제된 노드 자리에 다음 free 노드를 기록한다.
+			struct free_node
+			{
+				free_node*	next;
+			};
+
+			//chunk의 첫 번째 노드 자리에 chunk 정보를 기록한다.
+			struct chunk_header
+			{
+				Node*		next;
+				size_type	size;
+			};
+
+			enum { FIRST_CHUNK = 32, MAX_CHUNK = 4096 };
+
+			allocator_type	_alloc;
+			Node*			_chunks;
+			free_node*		_free;
+			Node*			_cursor;
+			Node*			_cursor_end;
+			size_type		_next_chunk;
+
+		public:
+			explicit node_pool(const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _chunks(NULL), _free(NULL), _cursor(NULL), _cursor_end(NULL), _next_chunk(FIRST_CHUNK) {}
+
+			//pool은 tree마다 따로 가지므로 복사하면 allocator만 복사한 빈 pool이 된다.
+			node_pool(const node_pool& other)
+			: _alloc(other._alloc), _chunks(NULL), _free(NULL), _cursor(NULL), _cursor_end(NULL), _next_chunk(FIRST_CHUNK) {}
+
+			~node_pool()
+			{
+				release();
+			}
+
+			Node* allocate()
+			{
+				if (this->_free != NULL)
+				{
+					Node* res = reinterpret_cast<Node*>(this->_free);
+					this->_free = this->_free->next;
+					return (res);
+				}
+				if (this->_cursor == this->_cursor_end)
+					grow();
+				return (this->_cursor++);
+			}
+
+			void deallocate(Node* node)
+			{
+				free_node* res = reinterpret_cast<free_node*>(node);
+				res->next = this->_free;
+				this->_free = res;
+			}
+
+			//모든 chunk를 allocator에 돌려준다. 살아있는 노드가 없을 때만 호출해야 한다.
+			void release()
+			{
+				while (this->_chunks != NULL)
+				{
+					chunk_header* header = reinterpret_cast<chunk_header*>(this->_chunks);
+					Node* next = header->next;
+					this->_alloc.deallocate(this->_chunks, header->size);
+					this->_chunks = next;
+				}
+				this->_free = NULL;
+				this->_cursor = NULL;
+				this->_cursor_end = NULL;
+				this->_next_chunk = FIRST_CHUNK;
+			}
+
+			size_type max_size() const
+			{
+				return (this->_alloc.max_size());
+			}
+
+			allocator_type& get_allocator()
+			{
+				return (this->_alloc);
+			}
+
+			void swap(node_pool& other)
+			{
+				swap_value(this->_alloc, other._alloc);
+				swap_value(this->_chunks, other._chunks);
+				swap_value(this->_free, other._free);
+				swap_value(this->_cursor, other._cursor);
+				swap_value(this->_cursor_end, other._cursor_end);
+				swap_value(this->_next_chunk, other._next_chunk);
+			}
+
+		private:
+			node_pool& operator=(const node_pool&);
+
+			//새 chunk를 받아 chunk list 앞에 연결하고, 첫 노드 자리를 제외한 나머지를 잘라 쓸 영역으로 지정한다.
+			void grow()
+			{
+				size_type size = this->_next_chunk;
+				Node* chunk = this->_alloc.allocate(size);
+				chunk_header* header = reinterpret_cast<chunk_header*>(chunk);
+				header->next = this->_chunks;
+				header->size = size;
+				this->_chunks = chunk;
+				this->_cursor = chunk + 1;
+				this->_cursor_end = chunk + size;
+				if (this->_next_chunk < MAX_CHUNK)
+					this->_next_chunk *= 2;
+			}
+
+			template <typename _T>
+			static void swap_value(_T& a, _T& b)
+			{
+				_T tmp(a);
+				a = b;
+				b = tmp;
+			}
+	};
+} // namespace ft
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <stdexcept>
 #include "RBTreeIterator.hpp"
+#include "NodePool.hpp"
 #include "printMap.hpp"
 
 namespace ft
@@ -63,10 +64,14 @@ namespace ft
 	 * @tparam T		value_type (pair of key and mapped_type)
 	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.
 	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.
+	 * @tparam OrderStatistic	true이면 노드마다 서브트리 노드 수를 유지해 select/rank/distance를 O(logN)으로 제공한다.
+	 *							기본값 false에서는 노드 크기와 삽입/삭제 비용이 그대로이다.
+	 * @tparam Threaded	true이면 노드마다 중위 순회의 prev/next를 유지해 iterator 이동이 O(1)이 된다.
+	 *					nil노드가 list의 head이다. (nil->next = 가장 작은 노드, nil->prev = 가장 큰 노드)
 	 */
 	//typename NodeAlloc = std::allocator< ft::RB_TreeNode< T >
 	//typename NodeAlloc node_alloc_type
-	template < typename T, typename Compare = ft::less<T>, typename Alloc = std::allocator<T> >
+	template < typename T, typename Compare = ft::less<T>, typename Alloc = std::allocator<T>, bool OrderStatistic = false, bool Threaded = false >
 	class RBTree {
 		public :
 			/**
@@ -80,10 +85,13 @@ namespace ft
 			typedef Compare	value_comp;
 			typedef Alloc	allocator_type;
 			typedef size_t	size_type;
-			typedef ft::RBTreeNode<T>	node_type;
-			typedef typename ft::RBTreeIterator<T, T*, T&>	iterator;
-			typedef typename ft::RBTreeIterator<T, const T*, const T&>	const_iterator;
+			typedef ft::RBTreeNode<T, OrderStatistic, Threaded>	node_type;
+			typedef ft::RBTreeStep<Threaded>	step_type;
+			typedef typename ft::RBTreeIterator<T, T*, T&, node_type>	iterator;
+			typedef typename ft::RBTreeIterator<T, const T*, const T&, node_type>	const_iterator;
 			typedef typename Alloc::template rebind<node_type>::other	node_allocator_type;
+			//Alloc이 ft::pool_allocator이면 노드를 slab pool에서 할당한다.
+			typedef ft::node_pool<node_type, node_allocator_type, ft::is_pool_allocator<Alloc>::value>	node_pool_type;
 			/**
 			 * @brief rebind
 			 *
@@ -105,36 +113,54 @@ namespace ft
 			 * @brief Member variables
 			 */
 			node_type*	_root;
+			//nil노드는 header 역할을 겸한다. _nil->parent는 가장 큰 노드(rightmost)를 가리킨다.
 			node_type*	_nil;
+			//가장 작은 노드. tree가 비어있으면 nil노드를 가리킨다.
+			node_type*	_leftmost;
 			size_type	_size;
 			value_comp	_comp;
-			node_allocator_type	_node_alloc;
+			allocator_type	_alloc;
+			node_pool_type	_node_pool;
 
 		public:
 			/**
 			 * @brief Member functions
 			 */
 			//Default constructor
-			RBTree() : _root(NULL), _nil(NULL), _size(0), _comp(value_comp()), _node_alloc(node_allocator_type())
+			//노드 allocator는 alloc을 rebind해서 만든다. -> map/set에 넘긴 allocator가 노드 저장소까지 그대로 사용된다.
+			explicit RBTree(const value_comp& comp = value_comp(), const allocator_type& alloc = allocator_type())
+			: _root(NULL), _nil(NULL), _leftmost(NULL), _size(0), _comp(comp), _alloc(alloc), _node_pool(node_allocator_type(alloc))
 			{
 				this->_nil = make_nil();
 				this->_root = this->_nil;
+				this->_leftmost = this->_nil;
 			}
 
 			//Copy constructor
-			RBTree(const RBTree& x) : _root(NULL), _nil(NULL), _size(0), _comp(value_comp()), _node_alloc(node_allocator_type())
+			RBTree(const RBTree& x) : _root(NULL), _nil(NULL), _leftmost(NULL), _size(0), _comp(x._comp), _alloc(x._alloc), _node_pool(x._node_pool)
 			{
 				this->_nil = make_nil();
-				copy(x);
-				this->_nil->parent = get_max_value_node();
+				this->_root = this->_nil;
+				this->_leftmost = this->_nil;
+				//생성자에서 예외가 나면 소멸자가 불리지 않는다. -> copy가 노드를 정리한 뒤 nil노드도 직접 해제한다.
+				try
+				{
+					copy(x);
+				}
+				catch (...)
+				{
+					_node_pool.get_allocator().deallocate(this->_nil, 1);
+					throw;
+				}
 			}
 
 			//Destructor
 			~RBTree()
 			{
 				clear();
-				_node_alloc.destroy(this->_nil);
-				_node_alloc.deallocate(this->_nil, 1);
+				//nil노드는 value를 생성하지 않았으므로 destroy 없이 해제한다.
+				//pool의 일괄 해제와 무관하도록 nil노드는 allocator에서 직접 할당한다.
+				_node_pool.get_allocator().deallocate(this->_nil, 1);
 			}
 
 			//Assignment operator
@@ -145,31 +171,57 @@ namespace ft
 				return (*this);
 			}
 
-			void copy(const RBTree& x)
+#ifdef FT_CXX11
+			//Move constructor
+			//빈 tree(nil노드만 있는)를 만든 뒤 x와 바꾼다. -> 노드를 옮기지 않는다.
+			RBTree(RBTree&& x) : _root(NULL), _nil(NULL), _leftmost(NULL), _size(0), _comp(x._comp), _alloc(x._alloc), _node_pool(x._node_pool)
 			{
-				clear();
-				copy(x._root);
+				this->_nil = make_nil();
+				this->_root = this->_nil;
+				this->_leftmost = this->_nil;
+				swap(x);
+			}
+
+			//Move assignment operator
+			RBTree& operator=(RBTree&& x)
+			{
+				if (this != &x)
+				{
+					clear();
+					swap(x);
+				}
+				return (*this);
 			}
+#endif
 
-			void copy(node_type* node)
+			//x의 노드 구조와 색을 그대로 복제한다.
+			//insert를 반복하면 비교와 재조정으로 O(NlogN)이 걸리지만, 복제는 비교 없이 노드마다 한 번씩 O(N)
+			void copy(const RBTree& x)
 			{
-				if (node->value == NULL)
+				clear();
+				if (x._size == 0)
 					return ;
-				insert(*node->value);
-				if (node->leftChild->value != NULL)
-					copy(node->leftChild);
-				if (node->rightChild->value != NULL)
-					copy(node->rightChild);
+				try
+				{
+					clone(x._root, this->_nil, this->_root);
+				}
+				catch (...)
+				{
+					//복제 도중 예외가 나면 이미 연결된 노드들을 정리하고 빈 tree로 되돌린다.
+					clear();
+					throw;
+				}
+				this->_size = x._size;
+				this->_leftmost = get_min_value_node();
+				this->_nil->parent = get_max_value_node();
+				thread_nodes();
 			}
 
 			//Iterators
-			//가장 작은 값을 찾는다.
+			//가장 작은 값을 가진 노드. insert/erase 때 갱신해두므로 탐색하지 않는다. -> O(1)
 			node_type* get_begin() const
 			{
-				node_type* tmp = this->_root;
-				while (tmp->leftChild->value != NULL)
-					tmp = tmp->leftChild;
-				return (tmp);
+				return (this->_leftmost);
 			}
 
 			//nil노드를 가리키게 한다.
@@ -178,6 +230,11 @@ namespace ft
 				return (this->_nil);
 			}
 
+			allocator_type get_allocator() const
+			{
+				return (this->_alloc);
+			}
+
 			//Capacity
 			bool empty() const
 			{
@@ -191,7 +248,7 @@ namespace ft
 
 			size_type max_size() const
 			{
-				return _node_alloc.max_size();
+				return _node_pool.max_size();
 			}
 
 			//Element access
@@ -251,12 +308,61 @@ namespace ft
 			 */
 			ft::pair<node_type*, bool> insert(const value_type& val, node_type* hint = NULL)
 			{
-				//val 값을 인자로 입력하여 노드를 생성한다.
-				node_type* new_node = make_node(val);
-				//노드가 삽일될 위치를 탐색한다. tree가 비어있을 경우를 대비해 초기 위치를 root로 설정한다.
-				node_type* position = this->_root;
-				//tree가 비어있을 경우, 생성한 노드(new_node)를 root로 지정한다.
+				//같은 값이 이미 있으면 노드를 만들지 않고 기존 노드와 false를 반환한다.
+				bool insert_left = false;
+				ft::pair<node_type*, bool> is_valid = locate(val, hint, insert_left);
+				if (is_valid.second == false)
+					return (is_valid);
+				//삽입이 확정된 후에만 노드를 생성한다. value는 노드 안에서 한 번만 생성된다.
+				return (attach(make_node(val), is_valid.first, insert_left));
+			}
+
+#ifdef FT_CXX11
+			//val을 노드 안으로 move한다.
+			ft::pair<node_type*, bool> insert(value_type&& val, node_type* hint = NULL)
+			{
+				bool insert_left = false;
+				ft::pair<node_type*, bool> is_valid = locate(val, hint, insert_left);
+				if (is_valid.second == false)
+					return (is_valid);
+				return (attach(make_node(std::move(val)), is_valid.first, insert_left));
+			}
+
+			//args로 노드 안에 value를 바로 만든 뒤 그 value로 자리를 찾는다.
+			//같은 값이 이미 있으면 만든 노드를 해제한다. -> 값을 비교하려면 먼저 만들어야 한다.
+			template <class... Args>
+			ft::pair<node_type*, bool> emplace_hint(node_type* hint, Args&&... args)
+			{
+				node_type* new_node = make_node(std::forward<Args>(args)...);
+				bool insert_left = false;
+				ft::pair<node_type*, bool> is_valid = locate(new_node->value, hint, insert_left);
+				if (is_valid.second == false)
+				{
+					destroy_node(new_node);
+					return (is_valid);
+				}
+				return (attach(new_node, is_valid.first, insert_left));
+			}
+#endif
+
+		private:
+			//노드를 삽입할 위치(부모)를 탐색한다. tree가 비어 있으면 nil을 부모로 반환한다.
+			//hint가 있으면 hint와 그 이웃 노드로 위치를 확인하고, 맞지 않으면 root부터 탐색한다.
+			//single element의 경우 hint는 null
+			ft::pair<node_type*, bool> locate(const value_type& val, node_type* hint, bool& insert_left) const
+			{
 				if (this->_size == 0)
+					return (ft::make_pair(this->_nil, true));
+				if (hint != NULL)
+					return (get_hint_position(hint, val, insert_left));
+				return (get_position(this->_root, val, insert_left));
+			}
+
+			//locate로 찾은 부모 아래에 new_node를 연결하고 균형을 잡는다.
+			ft::pair<node_type*, bool> attach(node_type* new_node, node_type* parent, bool insert_left)
+			{
+				//tree가 비어있을 경우, 새로 만든 노드를 root로 지정한다.
+				if (parent->is_nil)
 				{
 					this->_root = new_node;
 					this->_root->leftChild = this->_nil;
@@ -264,30 +370,28 @@ namespace ft
 					this->_root->parent = this->_nil; //여기서 중요한 점이 root의 부모도 nil노드를 가리키게 설정
 					this->_root->color = BLACK;
 					this->_nil->parent = this->_root; //다시 nil의 부모를 root로 설정
+					this->_leftmost = this->_root;
+					thread_node(this->_root, this->_nil, false);
 					this->_size++;
 					return ft::make_pair(this->_root, true); //새로 만든
 				}
-				//hint의 위치가 유효한지 확인한다.
-				//single element의 경우 hint는 null
-				if (hint != NULL && hint->value != NULL)
-					position = check_hint(val, hint);
-				//노드를 삽입할 위치를 탐색한다.
-				//leftchild와 rightchild에 삽입을 실패하면 false를 반환
-				ft::pair<node_type*, bool> is_valid = get_position(position, new_node);
-				if (is_valid.second == false)
-				{
-					_node_alloc.destroy(new_node);
-					_node_alloc.deallocate(new_node, 1);
-					return (is_valid);
-				}
+				link_node(parent, new_node, insert_left);
+				thread_node(new_node, parent, insert_left);
+				adjust_counts(parent, true);
+				//가장 작은/큰 노드의 자식으로 붙었다면 새 노드가 leftmost/rightmost가 된다.
+				//회전은 중위 순서를 바꾸지 않으므로 재조정 후에도 그대로 유효하다.
+				if (insert_left && parent == this->_leftmost)
+					this->_leftmost = new_node;
+				else if (!insert_left && parent == this->_nil->parent)
+					this->_nil->parent = new_node;
 				//new_node 삽입 후 rbtree의 규칙(속성)에 따라 균형을 잡아야한다.
 				//이는 insert_case에 따라 rotate를 통해 진행한다.
 				insert_case1(new_node);
 				this->_size++;
-				this->_nil->parent = get_max_value_node();
 				return (ft::make_pair(new_node, true));
 			}
 
+		public:
 			/**
 			 * @brief rbtree erase
 			 *
@@ -361,8 +465,19 @@ namespace ft
 			size_type erase(node_type* node)
 			{
 				//삭제할 노드가 nil 노드인 경우 0을 반환 -> map에서 삭제가 실패한 경우 0을 반환
-				if (node->value == NULL)
+				if (node->is_nil)
 					return (0);
+				//삭제할 노드가 leftmost/rightmost라면 구조를 바꾸기 전에 다음/이전 노드로 옮겨둔다.
+				//tree가 비게 되면 둘 다 nil노드를 가리킨다.
+				//재조정 중에는 nil노드의 parent가 임시로 사용되므로 rightmost는 따로 보관했다가 마지막에 되돌린다.
+				if (node == this->_leftmost)
+					this->_leftmost = get_next_node(node);
+				node_type* rightmost = this->_nil->parent;
+				if (node == rightmost)
+					rightmost = get_prev_node(node);
+				//중위 순회 list에서 node를 뺀다.
+				if (Threaded)
+					step_type::link(step_type::prev(node), step_type::next(node));
 				//node의 왼쪽 서브트리에서 최댓값 / 오른쪽 서브트리에서 최솟값을 찾은 후 위치를 변경한다.
 				//기존 target위치에는 대체할 node가 들어가있다.
 				//target 노드 자체를 삭제해야 한다.
@@ -371,13 +486,15 @@ namespace ft
 				//child는 target노드의 non-nil child가 우선이다.
 				node_type* target = replace_erase_node(node);
 				node_type* child;
-				if (target->rightChild->value == NULL)
+				if (target->rightChild->is_nil)
 					child = target->leftChild;
 				else
 					child = target->rightChild;
 
 				//1)target이 RED인 경우, 무조건 그 자식 노드들이 nil일 때만 발생한다(BLACK). target을 nil로 바꾸면 해결
 				replace_node(target, child);
+				//target이 빠졌으므로 조상들의 서브트리 노드 수를 줄인 뒤 재조정한다. (회전은 자식의 count로 다시 계산한다.)
+				adjust_counts(target->parent, false);
 				if (target->color == BLACK)
 				{
 					//2)target이 BLACK이고 child가 RED인 경우,
@@ -392,61 +509,112 @@ namespace ft
 					//replace_node에서 child(nil)->parent를 상황에 맞게 설정
 				}
 				this->_size--;
-				if (target->parent->value == NULL)
+				if (target->parent->is_nil)
 					this->_root = this->_nil;
-				delete target;
-				this->_nil->parent = get_max_value_node();
+				destroy_node(target);
+				this->_nil->parent = rightmost;
 				return (1);
 			}
 
+			/**
+			 * @brief range insert
+			 *
+			 * [first, last)를 삽입한다.
+			 * tree가 비어있고 입력이 정렬된 고유값(이전 값 < 다음 값)이라면,
+			 * 입력을 한 번 읽으면서 노드를 만들어 chain으로 이어두고 bottom-up으로 완전 균형 tree를 만든다. -> O(N)
+			 * 정렬이 깨지는 원소를 만나면 그때까지 모은 노드로 tree를 만든 뒤, 나머지는 end를 hint로 삽입한다.
+			 * tree가 비어있지 않으면 end를 hint로 insert를 반복한다. -> 정렬된 부분은 O(1)로 위치를 찾는다.
+			 */
+			template <typename InputIterator>
+			void insert_range(InputIterator first, InputIterator last)
+			{
+				if (this->_size == 0)
+				{
+					//chain은 rightChild를 다음 노드를 가리키는 link로 사용한다.
+					node_type* head = this->_nil;
+					node_type* tail = this->_nil;
+					size_type count = 0;
+					try
+					{
+						while (first != last)
+						{
+							//입력 타입이 value_type과 다를 수 있으므로 한 번 변환해서 비교/생성에 같이 사용한다.
+							const value_type& val = *first;
+							if (!tail->is_nil && !_comp(tail->value, val))
+								break;
+							node_type* node = make_node(val);
+							++first;
+							if (tail->is_nil)
+								head = node;
+							else
+								tail->rightChild = node;
+							tail = node;
+							++count;
+						}
+					}
+					catch (...)
+					{
+						while (!head->is_nil)
+						{
+							node_type* next = head->rightChild;
+							destroy_node(head);
+							head = next;
+						}
+						throw;
+					}
+					build_balanced(head, count);
+				}
+				//정렬된 입력이 이어지면 end를 hint로 주어 rightmost 뒤에 바로 붙인다.
+				while (first != last)
+					insert(*first++, this->_nil);
+			}
+
 			void swap(RBTree& x)
 			{
 				swap(_root, x._root);
 				swap(_nil, x._nil);
+				swap(_leftmost, x._leftmost);
 				swap(_comp, x._comp);
-				swap(_node_alloc, x._node_alloc);
+				swap(_alloc, x._alloc);
+				_node_pool.swap(x._node_pool);
 				swap(_size, x._size);
 			}
 
-			void clear(node_type* node = NULL)
+			void clear()
 			{
-				if (node == NULL)
-					node = this->_root;
-				if (node->leftChild->value != NULL)
-				{
-					clear(node->leftChild);
-					node->leftChild = this->_nil;
-				}
-				if (node->rightChild->value != NULL)
-				{
-					clear(node->rightChild);
-					node->rightChild = this->_nil;
-				}
-				// delete
-				if (node->value != NULL)
-				{
-					if (node == this->_root)
-						this->_root = this->_nil;
-					_node_alloc.destroy(node);
-					_node_alloc.deallocate(node, 1);
-					this->_size--;
-				}
+				//소멸자가 필요 없는 value를 pool에 담고 있으면 노드를 순회하지 않고 chunk만 돌려준다.
+				if (!(ft::is_trivially_destructible<value_type>::value && ft::is_pool_allocator<Alloc>::value))
+					clear(this->_root);
+				this->_root = this->_nil;
+				this->_leftmost = this->_nil;
+				this->_nil->parent = this->_nil;
+				step_type::link(this->_nil, this->_nil);
+				this->_size = 0;
+				//노드가 모두 해제되었으므로 pool의 chunk를 한 번에 돌려준다.
+				_node_pool.release();
 			}
 
 			//Operations
-			node_type* find(value_type val) const
+			/**
+			 * @brief find
+			 * key와 동등한 값을 가진 노드를, 없으면 nil노드를 반환한다.
+			 * key는 value_type이 아니어도 된다. _comp(key, value)와 _comp(value, key)로 비교할 수 있으면 된다.
+			 * -> map은 value_compare가 pair의 first와 key를 직접 비교하므로 lookup 시 value_type을 만들지 않는다.
+			 */
+			template <typename K>
+			node_type* find(const K& key) const
 			{
 				node_type* res = this->_root;
-				if (this->_size == 0)
-					return (this->_nil);
-				while (res->value != NULL && (_comp(val, *res->value) || _comp(*res->value, val)))
+				while (!res->is_nil)
 				{
-					if (_comp(val, *res->value))
+					if (_comp(key, res->value))
 						res = res->leftChild;
-					else
+					else if (_comp(res->value, key))
 						res = res->rightChild;
+					else
+						return (res);
 				}
-				return (res);
+				return (this->_nil);
 			}
 
 			/**
@@ -461,23 +629,87 @@ namespace ft
 			 */
 
 			//val보다 크거나 같은 범위를 구하기 위함.
-			node_type* lower_bound(const value_type& val) const
+			//root부터 내려가며 val보다 작지 않은 노드를 후보로 기록하고 왼쪽으로, 작은 노드면 오른쪽으로 이동한다. -> O(logN)
+			template <typename K>
+			node_type* lower_bound(const K& val) const
 			{
-				iterator it(get_begin());
-				iterator ite(get_end());
-				while (it != ite && _comp(*it, val))
-					it++;
-				return (it.base());
+				node_type* res = this->_nil;
+				node_type* tmp = this->_root;
+				while (!tmp->is_nil)
+				{
+					if (!_comp(tmp->value, val))
+					{
+						res = tmp;
+						tmp = tmp->leftChild;
+					}
+					else
+						tmp = tmp->rightChild;
+				}
+				return (res);
 			}
 
 			//val보다 큰 범위를 구하는 함수
-			node_type* upper_bound(const value_type& val) const
+			//root부터 내려가며 val보다 큰 노드를 후보로 기록하고 왼쪽으로, 크지 않은 노드면 오른쪽으로 이동한다. -> O(logN)
+			template <typename K>
+			node_type* upper_bound(const K& val) const
+			{
+				node_type* res = this->_nil;
+				node_type* tmp = this->_root;
+				while (!tmp->is_nil)
+				{
+					if (_comp(val, tmp->value))
+					{
+						res = tmp;
+						tmp = tmp->leftChild;
+					}
+					else
+						tmp = tmp->rightChild;
+				}
+				return (res);
+			}
+
+			/**
+			 * @brief order statistic
+			 * OrderStatistic = true 일 때만 사용할 수 있다. (false이면 count가 없으므로 컴파일되지 않는다.)
+			 * 서브트리 노드 수를 따라 root에서 한 번 내려가므로 O(logN)
+			 */
+			//k번째(0부터 시작)로 작은 값을 가진 노드를 반환한다. k >= size이면 nil노드를 반환한다.
+			node_type* select(size_type k) const
+			{
+				node_type* node = this->_root;
+				while (!node->is_nil)
+				{
+					size_type left = node->leftChild->count;
+					if (k < left)
+						node = node->leftChild;
+					else if (k == left)
+						return (node);
+					else
+					{
+						k -= left + 1;
+						node = node->rightChild;
+					}
+				}
+				return (this->_nil);
+			}
+
+			//key보다 작은 값의 개수를 반환한다. (lower_bound의 위치)
+			template <typename K>
+			size_type rank(const K& key) const
 			{
-				iterator it(get_begin());
-				iterator ite(get_end());
-				while (it != ite && !_comp(val, *it))
-					it++;
-				return (it.base());
+				size_type res = 0;
+				node_type* node = this->_root;
+				while (!node->is_nil)
+				{
+					if (_comp(node->value, key))
+					{
+						res += node->leftChild->count + 1;
+						node = node->rightChild;
+					}
+					else
+						node = node->leftChild;
+				}
+				return (res);
 			}
 
 			//test end print map function
@@ -514,93 +746,284 @@ namespace ft
 					return (node->parent->leftChild);
 			}
 
+			//tree에서 가장 작은 값을 가지는 노드를 찾는다. 복제/일괄 생성 후 leftmost를 지정할 때만 사용한다.
+			node_type* get_min_value_node() const
+			{
+				node_type* tmp = _root;
+				while (!tmp->leftChild->is_nil)
+					tmp = tmp->leftChild;
+				return (tmp);
+			}
+
 			//tree에서 가장 큰 값을 가지는 노드를 찾는다.
 			//tree에서 가장 오른쪽에 있는 값이 가장 큰 값이다.
 			node_type* get_max_value_node() const
 			{
 				node_type* tmp = _root;
-				while (tmp->rightChild->value != NULL)
+				while (!tmp->rightChild->is_nil)
 					tmp = tmp->rightChild;
 				return (tmp);
 			}
 
+			//중위 순회에서 node의 다음 노드. 없으면 nil노드를 반환한다.
+			node_type* get_next_node(node_type* node) const
+			{
+				return (step_type::next(node));
+			}
+
+			//중위 순회에서 node의 이전 노드. 없으면 nil노드를 반환한다.
+			node_type* get_prev_node(node_type* node) const
+			{
+				return (step_type::prev(node));
+			}
+
+			//새 노드를 중위 순회 list에 연결한다. 왼쪽 자식이면 parent 바로 앞, 오른쪽 자식이면 바로 뒤에 들어간다.
+			void thread_node(node_type* node, node_type* parent, bool insert_left)
+			{
+				if (!Threaded)
+					return ;
+				node_type* before = insert_left ? step_type::prev(parent) : parent;
+				node_type* after = step_type::next(before);
+				step_type::link(before, node);
+				step_type::link(node, after);
+			}
+
+			//복제/일괄 생성처럼 tree 구조를 한 번에 만든 뒤, 구조를 따라 순회하며 list를 다시 연결한다. -> O(N)
+			void thread_nodes()
+			{
+				if (!Threaded)
+					return ;
+				node_type* before = this->_nil;
+				for (node_type* node = this->_leftmost; !node->is_nil; node = ft::RBTreeStep<false>::next(node))
+				{
+					step_type::link(before, node);
+					before = node;
+				}
+				step_type::link(before, this->_nil);
+			}
+
 			//nil 노드를 만든다.
 			//아무런 값이 없는 노드, tree의 leat노드이다.
+			//value는 생성하지 않고 link/color/is_nil만 초기화한다. -> value_type에 기본 생성자가 필요없다.
 			node_type* make_nil()
 			{
-				node_type* res = _node_alloc.allocate(1);
-				_node_alloc.construct(res, node_type());
+				node_type* res = _node_pool.get_allocator().allocate(1);
 				res->color = BLACK;
+				res->is_nil = true;
+				res->set_count(0);
+				step_type::link(res, res);
 				res->leftChild = res;
 				res->rightChild = res;
 				res->parent = res;
-				res->value = NULL;
 				return (res);
 			}
 
+			//node를 root로 하는 서브트리를 같은 모양/색으로 복제해서 parent의 자식 자리(link)에 연결한다.
+			//새 노드는 자식을 복제하기 전에 먼저 link에 연결하고, 아직 복제하지 않은 자식은 nil로 남아 있다.
+			//-> 중간에 예외가 나도 지금까지 만든 노드는 모두 _root에서 닿으므로 clear()로 전부 해제된다.
+			void clone(const node_type* node, node_type* parent, node_type*& link)
+			{
+				node_type* res = make_node(node->value);
+				res->color = node->color;
+				res->set_count(node->get_count());
+				res->parent = parent;
+				link = res;
+				if (!node->leftChild->is_nil)
+					clone(node->leftChild, res, res->leftChild);
+				if (!node->rightChild->is_nil)
+					clone(node->rightChild, res, res->rightChild);
+			}
+
+			//정렬된 chain의 노드 count개로 완전 균형 tree를 만들어 root로 지정한다.
+			//좌우 서브트리의 크기 차이가 최대 1이므로 nil노드는 인접한 두 level에만 존재한다.
+			//-> 가장 깊은 level(floor(log2(count)))의 노드만 red로 칠하면 모든 경로의 black 수가 같다.
+			void build_balanced(node_type* head, size_type count)
+			{
+				if (count == 0)
+					return ;
+				size_type red_depth = 0;
+				for (size_type n = count; n > 1; n >>= 1)
+					++red_depth;
+				this->_root = build_subtree(head, count, 0, red_depth);
+				this->_root->parent = this->_nil;
+				this->_root->color = BLACK;
+				this->_size = count;
+				this->_leftmost = get_min_value_node();
+				this->_nil->parent = get_max_value_node();
+				thread_nodes();
+			}
+
+			//chain의 앞에서부터 count개를 중위 순서대로 꺼내 서브트리를 만든다.
+			//list는 아직 사용하지 않은 chain의 첫 노드를 가리키도록 갱신된다.
+			node_type* build_subtree(node_type*& list, size_type count, size_type depth, size_type red_depth)
+			{
+				if (count == 0)
+					return (this->_nil);
+				size_type left_count = (count - 1) / 2;
+				node_type* left = build_subtree(list, left_count, depth + 1, red_depth);
+				node_type* node = list;
+				list = list->rightChild;
+				node->leftChild = left;
+				if (!left->is_nil)
+					left->parent = node;
+				node->rightChild = build_subtree(list, count - 1 - left_count, depth + 1, red_depth);
+				if (!node->rightChild->is_nil)
+					node->rightChild->parent = node;
+				node->color = (depth == red_depth) ? RED : BLACK;
+				update_count(node);
+				return (node);
+			}
+
 			//value 값을 가지는 노드를 만든다.
 			//노드의 색/자식/부모는 삽입 후 tree의 속성에 맞게 재조정 후 결정한다.
+			//노드는 raw memory로 할당하고 value는 그 안에 바로 생성한다. -> 임시 노드/value 복사가 없다.
+#ifdef FT_CXX11
+			//c++11에서는 인자를 value의 생성자로 그대로 넘긴다. (copy, move, emplace)
+			template <class... Args>
+			node_type* make_node(Args&&... args)
+#else
 			node_type* make_node(const value_type& val)
+#endif
 			{
-				node_type* res = _node_alloc.allocate(1);
-				_node_alloc.construct(res, node_type(val));
+				node_type* res = _node_pool.allocate();
+				try
+				{
+#ifdef FT_CXX11
+					_alloc.construct(&res->value, std::forward<Args>(args)...);
+#else
+					_alloc.construct(&res->value, val);
+#endif
+				}
+				catch (...)
+				{
+					_node_pool.deallocate(res);
+					throw;
+				}
+				res->parent = this->_nil;
+				res->leftChild = this->_nil;
+				res->rightChild = this->_nil;
+				res->color = RED;
+				res->is_nil = false;
+				res->set_count(1);
 				return (res);
 			}
 
 			/**
-			 * Hint 쓰는 경우. (hint가 적절한 위치인 경우)
-			 * inserted value는 hint node의 right-sub-tree로 들어간다.
-			 * 공통 조건 :  hint < inserted value 인 경우.
-			 * 1) hint가 leftChild인 경우, inserted value < hint-parent 이면, hint부터 탐색.
-			 * 2) hint가 rightChild인 경우, parent를 따라가다가 처음으로 leftChild인  d노드의 parent보다 작으면 hint부터 탐색.
+			 * node를 root로 하는 서브트리의 노드를 모두 해제한다.
+			 * 재귀 대신 회전으로 트리를 펴가며 해제한다.
+			 * - 왼쪽 자식이 있으면 오른쪽으로 회전시켜 왼쪽 자식을 위로 올린다.
+			 * - 왼쪽 자식이 없으면 현재 노드를 해제하고 오른쪽 자식으로 내려간다.
+			 * 회전마다 왼쪽 link가 하나씩 줄어들므로 회전 횟수는 n번을 넘지 않는다. -> O(n), 추가 메모리 O(1)
+			 * 해제할 노드들이므로 parent와 color는 갱신하지 않는다.
 			 */
-			node_type* check_hint(value_type val, node_type* hint)
-			{
-				if (_comp(*hint->value, *_root->value) && _comp(val, *hint->value))
-					return (hint);
-				else if (_comp(*hint->value, *_root->value) && _comp(*hint->value, val))
-					return (_root);
-				else if (_comp(*_root->value, *hint->value) && _comp(val, *hint->value))
-					return (_root);
-				else if (_comp(*_root->value, *hint->value) && _comp(*hint->value, val))
-					return (hint);
+			void clear(node_type* node)
+			{
+				while (!node->is_nil)
+				{
+					node_type* left = node->leftChild;
+					if (!left->is_nil)
+					{
+						node->leftChild = left->rightChild;
+						left->rightChild = node;
+						node = left;
+					}
+					else
+					{
+						node_type* right = node->rightChild;
+						destroy_node(node);
+						node = right;
+					}
+				}
+			}
+
+			//make_node로 만든 노드의 value를 소멸시키고 노드를 해제한다.
+			//소멸자가 아무 일도 하지 않는 타입은 destroy를 생략한다.
+			void destroy_node(node_type* node)
+			{
+				if (!ft::is_trivially_destructible<value_type>::value)
+					_alloc.destroy(&node->value);
+				_node_pool.deallocate(node);
+			}
+
+			/**
+			 * @brief hint를 사용한 삽입 위치 탐색
+			 *
+			 * val이 hint 바로 앞에 들어갈 자리인지 hint와 그 이웃 노드만 비교해서 확인한다.
+			 * - hint가 end(nil)인 경우: rightmost < val 이면 rightmost의 오른쪽 자식
+			 * - val < hint인 경우: hint가 leftmost이거나 prev(hint) < val 이면 둘 사이
+			 * - hint < val인 경우: hint가 rightmost이거나 val < next(hint) 이면 둘 사이
+			 * - val == hint인 경우: hint를 그대로 반환
+			 * 두 노드 사이에 들어가는 경우, 두 노드 중 하나는 반드시 그 방향의 자식이 비어있다.
+			 * 위의 경우가 아니면 hint가 틀린 것이므로 root부터 탐색한다.
+			 * -> 증가하는 key를 end()나 직전에 삽입한 원소를 hint로 넣으면 탐색 없이 O(1)로 위치를 찾는다. (재조정은 amortized O(1))
+			 */
+			ft::pair<node_type*, bool> get_hint_position(node_type* hint, const value_type& val, bool& insert_left) const
+			{
+				if (hint->is_nil)
+				{
+					if (_comp(this->_nil->parent->value, val))
+					{
+						insert_left = false;
+						return (ft::make_pair(this->_nil->parent, true));
+					}
+				}
+				else if (_comp(val, hint->value))
+				{
+					if (hint == this->_leftmost)
+					{
+						insert_left = true;
+						return (ft::make_pair(hint, true));
+					}
+					node_type* before = get_prev_node(hint);
+					if (_comp(before->value, val))
+					{
+						insert_left = !before->rightChild->is_nil;
+						return (ft::make_pair(insert_left ? hint : before, true));
+					}
+				}
+				else if (_comp(hint->value, val))
+				{
+					if (hint == this->_nil->parent)
+					{
+						insert_left = false;
+						return (ft::make_pair(hint, true));
+					}
+					node_type* after = get_next_node(hint);
+					if (_comp(val, after->value))
+					{
+						insert_left = !hint->rightChild->is_nil;
+						return (ft::make_pair(insert_left ? after : hint, true));
+					}
+				}
 				else
-					return (_root);
+					return (ft::make_pair(hint, false));
+				return (get_position(this->_root, val, insert_left));
 			}
 
 			//노드를 삽입할 위치를 탐색하는 함수이다.
-			//make_pair로 한 쌍의 pair를 만든 후 삽입이 가능한지 true/false를 반환한다.
-			ft::pair<node_type*, bool> get_position(node_type* position, node_type* node)
+			//삽입 가능하면 (부모가 될 노드, true)를, 같은 값이 있으면 (그 노드, false)를 반환한다.
+			//insert_left에는 부모의 왼쪽/오른쪽 중 어디에 붙여야 하는지를 기록한다.
+			ft::pair<node_type*, bool> get_position(node_type* position, const value_type& val, bool& insert_left) const
 			{
-				while (position->value != NULL)
+				while (!position->is_nil)
 				{
-					if (_comp(*node->value, *position->value)) //position을 기준으로 leftchild로 들어감
+					if (_comp(val, position->value)) //position을 기준으로 leftchild로 들어감
 					{
-						if (position->leftChild->value == NULL)
+						if (position->leftChild->is_nil)
 						{
-							position->leftChild = node;
-							node->parent = position;
-							node->leftChild = _nil;
-							node->rightChild = _nil;
-							node->color = RED;
+							insert_left = true;
 							break;
 						}
-						else
-							position = position->leftChild;
+						position = position->leftChild;
 					}
-					else if (_comp(*position->value, *node->value)) //position을 기준으로 rightchild로 들어감
+					else if (_comp(position->value, val)) //position을 기준으로 rightchild로 들어감
 					{
-						if (position->rightChild->value == NULL)
+						if (position->rightChild->is_nil)
 						{
-							position->rightChild = node;
-							node->parent = position;
-							node->leftChild = _nil;
-							node->rightChild = _nil;
-							node->color = RED;
+							insert_left = false;
 							break;
 						}
-						else
-							position = position->rightChild;
+						position = position->rightChild;
 					}
 					else
 						return (ft::make_pair(position, false));
@@ -608,6 +1031,34 @@ namespace ft
 				return (ft::make_pair(position, true));
 			}
 
+			//get_position으로 찾은 부모의 왼쪽/오른쪽 자식으로 노드를 연결한다.
+			void link_node(node_type* parent, node_type* node, bool insert_left)
+			{
+				if (insert_left)
+					parent->leftChild = node;
+				else
+					parent->rightChild = node;
+				node->parent = parent;
+				node->leftChild = this->_nil;
+				node->rightChild = this->_nil;
+				node->color = RED;
+			}
+
+			//자식의 서브트리 노드 수로 node의 count를 다시 계산한다. OrderStatistic이 아니면 아무 일도 하지 않는다.
+			void update_count(node_type* node)
+			{
+				node->set_count(node->leftChild->get_count() + node->rightChild->get_count() + 1);
+			}
+
+			//node부터 root까지 조상들의 count를 1씩 늘리거나 줄인다.
+			void adjust_counts(node_type* node, bool increase)
+			{
+				if (!OrderStatistic)
+					return ;
+				for (; !node->is_nil; node = node->parent)
+					node->set_count(increase ? node->get_count() + 1 : node->get_count() - 1);
+			}
+
 			node_type* replace_erase_node(node_type* node)
 			{
 				/**
@@ -624,16 +1075,16 @@ namespace ft
 				 */
 
 				node_type* res;
-				if (node->leftChild->value != NULL)
+				if (!node->leftChild->is_nil)
 				{
 					res = node->leftChild;
-					while (res->rightChild->value != NULL)
+					while (!res->rightChild->is_nil)
 						res = res->rightChild;
 				}
-				else if (node->rightChild->value != NULL)
+				else if (!node->rightChild->is_nil)
 				{
 					res = node->rightChild;
-					while (res->leftChild->value != NULL)
+					while (!res->leftChild->is_nil)
 						res = res->leftChild;
 				}
 				else
@@ -646,10 +1097,10 @@ namespace ft
 
 				//node의 left/rightChild 설정
 				node->leftChild = res->leftChild;
-				if (res->leftChild->value != NULL)
+				if (!res->leftChild->is_nil)
 					res->leftChild->parent = node;
 				node->rightChild = res->rightChild;
-				if (res->rightChild->value != NULL)
+				if (!res->rightChild->is_nil)
 					res->rightChild->parent = node;
 
 				//res를 node->parent의 left/rightChild로 설정
@@ -688,10 +1139,14 @@ namespace ft
 				//res의 parent 연결
 				res->parent = tmp_parent;
 
-				if (res->parent->value == NULL)
+				if (res->parent->is_nil)
 					this->_root = res;
 				node->color = res->color;
 				res->color = tmp_color;
+				//위치를 바꿨으므로 서브트리 노드 수도 바꾼다.
+				size_type tmp_count = node->get_count();
+				node->set_count(res->get_count());
+				res->set_count(tmp_count);
 
 				return (node);
 			}
@@ -712,7 +1167,7 @@ namespace ft
 				 * @brief insert_case1
 				 * 삽입된 새로운 노드가 root노드가 아닌 경우
 				 */
-				if (node->parent->value != NULL)
+				if (!node->parent->is_nil)
 					insert_case2(node);
 				else
 					node->color = BLACK;
@@ -746,7 +1201,7 @@ namespace ft
 
 				node_type* uncle = get_uncle(node);
 				node_type* grand;
-				if (uncle->value != NULL && uncle->color == RED)
+				if (!uncle->is_nil && uncle->color == RED)
 				{
 					node->parent->color = BLACK;
 					uncle->color = BLACK;
@@ -827,14 +1282,14 @@ namespace ft
 				node_type* child = node->rightChild;
 				node_type* parent = node->parent;
 				//node를 기준으로 왼쪽으로 회전하는 경우
-				if (child->leftChild->value != NULL)
+				if (!child->leftChild->is_nil)
 					child->leftChild->parent = node;
 				node->rightChild = child->leftChild;
 				node->parent = child;
 				child->leftChild = node;
 				child->parent = parent;
 				//node가 부모의 왼쪽 자식인지 오른쪽 자식인지 판단.
-				if (parent->value != NULL)
+				if (!parent->is_nil)
 				{
 					if (parent->leftChild == node)
 						parent->leftChild = child;
@@ -843,6 +1298,8 @@ namespace ft
 				}
 				else
 					this->_root = child;
+				update_count(node);
+				update_count(child);
 			}
 
 			//child가 node의 오른쪽 자식일 경우 rotate_left를 한다.
@@ -850,13 +1307,13 @@ namespace ft
 			{
 				node_type* child = node->leftChild;
 				node_type* parent = node->parent;
-				if (child->rightChild->value != NULL)
+				if (!child->rightChild->is_nil)
 					child->rightChild->parent = node;
 				node->leftChild = child->rightChild;
 				node->parent = child;
 				child->rightChild = node;
 				child->parent = parent;
-				if (parent->value != NULL)
+				if (!parent->is_nil)
 				{
 					if (parent->rightChild == node)
 						parent->rightChild = child;
@@ -865,6 +1322,8 @@ namespace ft
 				}
 				else
 					this->_root = child;
+				update_count(node);
+				update_count(child);
 			}
 
 			void delete_case1(node_type* node)
@@ -878,7 +1337,7 @@ namespace ft
 				 *
 				 * 이 경우가 아닌 경우, delete_case2로 넘어간다.
 				 */
-				if (node->parent->value != NULL)
+				if (!node->parent->is_nil)
 					delete_case2(node);
 			}
 
@@ -1060,6 +1519,42 @@ namespace ft
 			}
 
 	};
+
+	/**
+	 * @brief rb_tree_index
+	 * order statistic tree의 노드가 중위 순회에서 몇 번째(0부터)인지 구한다. -> O(logN)
+	 * nil노드(end)는 원소의 개수를 반환한다. (nil노드의 parent는 가장 큰 노드이다.)
+	 */
+	template <typename T, bool Threaded>
+	size_t rb_tree_index(const RBTreeNode<T, true, Threaded>* node)
+	{
+		if (node->is_nil)
+		{
+			node = node->parent;
+			if (node->is_nil)
+				return (0);
+			return (rb_tree_index(node) + 1);
+		}
+		size_t res = node->leftChild->count;
+		for (; !node->parent->is_nil; node = node->parent)
+		{
+			if (node == node->parent->rightChild)
+				res += node->parent->leftChild->count + 1;
+		}
+		return (res);
+	}
+
+	/**
+	 * @brief distance
+	 * order statistic tree의 iterator는 하나씩 이동하지 않고 두 노드의 순위 차이로 거리를 구한다. -> O(logN)
+	 */
+	template <typename T, typename Pointer, typename Reference, bool Threaded>
+	typename RBTreeIterator<T, Pointer, Reference, RBTreeNode<T, true, Threaded> >::difference_type
+	distance(RBTreeIterator<T, Pointer, Reference, RBTreeNode<T, true, Threaded> > first, RBTreeIterator<T, Pointer, Reference, RBTreeNode<T, true, Threaded> > last)
+	{
+		typedef typename RBTreeIterator<T, Pointer, Reference, RBTreeNode<T, true, Threaded> >::difference_type	difference_type;
+		return (static_cast<difference_type>(rb_tree_index(last.base())) - static_cast<difference_type>(rb_tree_index(first.base())));
+	}
 } // namespace ft
 
 
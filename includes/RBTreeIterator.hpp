@@ -17,7 +17,97 @@
  */
 namespace ft
 {
-	template <typename T, typename Pointer = T*, typename Reference = T&>
+	/**
+	 * @brief RBTreeStep
+	 * 중위 순회에서 노드의 다음/이전 노드를 구한다.
+	 * 끝을 넘어가면 nil노드를 반환하고, nil노드의 이전 노드는 가장 큰 노드이다.
+	 *
+	 * Threaded = false : 자식/부모 link를 따라 이동한다.
+	 * Threaded = true : 노드에 저장된 prev/next를 그대로 읽는다. -> O(1)
+	 */
+	template <bool Threaded>
+	struct RBTreeStep
+	{
+		template <typename Node>
+		static Node* next(Node* node)
+		{
+			Node* tmp = NULL;
+			if (!node->rightChild->is_nil)
+			{	// if rightChild exists,
+				tmp = node->rightChild;
+				// search the leftmost of the rightChild.
+				while (!tmp->leftChild->is_nil)
+					tmp = tmp->leftChild;
+			}
+			else
+			{	// if rightChild doesn't exist,
+				tmp = node->parent;
+				if (tmp->rightChild == node)
+				{	// if current node is rightChild,
+					while (tmp->parent->rightChild == tmp)
+						tmp = tmp->parent;
+					tmp = tmp->parent;
+				}
+			}
+			return (tmp);
+		}
+
+		template <typename Node>
+		static Node* prev(Node* node)
+		{
+			Node* tmp = NULL;
+			if (node->is_nil)
+				tmp = node->parent;
+			else if (!node->leftChild->is_nil)
+			{	// if leftChild exists,
+				tmp = node->leftChild;
+				// search the rightmost of the leftChild.
+				while (!tmp->rightChild->is_nil)
+					tmp = tmp->rightChild;
+			}
+			else
+			{	// if leftChild doesn't exist,
+				tmp = node->parent;
+				if (tmp->leftChild == node)
+				{	// if current node is leftChild,
+					while (tmp->parent->leftChild == tmp)
+						tmp = tmp->parent;
+					tmp = tmp->parent;
+				}
+			}
+			return (tmp);
+		}
+
+		//link를 저장하지 않으므로 아무 일도 하지 않는다.
+		template <typename Node>
+		static void link(Node*, Node*) {}
+	};
+
+	template <>
+	struct RBTreeStep<true>
+	{
+		template <typename Node>
+		static Node* next(Node* node)
+		{
+			return (node->next);
+		}
+
+		template <typename Node>
+		static Node* prev(Node* node)
+		{
+			return (node->prev);
+		}
+
+		//before 다음에 after가 오도록 연결한다.
+		template <typename Node>
+		static void link(Node* before, Node* after)
+		{
+			before->next = after;
+			after->prev = before;
+		}
+	};
+
+	template <typename T, typename Pointer = T*, typename Reference = T&, typename Node = ft::RBTreeNode<T> >
 	class RBTreeIterator : public ft::iterator<ft::bidirectional_iterator_tag, T>
 	{
 		public :
@@ -26,7 +116,7 @@ namespace ft
 			typedef Reference	reference;
 			typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::difference_type	difference_type;
 			typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::iterator_category	iterator_category;
-			typedef ft::RBTreeNode<T> node_type;
+			typedef Node node_type;
 		protected :
 			node_type* _node;
 
@@ -36,15 +126,10 @@ namespace ft
 			 */
 			//Default constructor
 			RBTreeIterator(node_type* ptr = NULL) : _node(ptr) {}
-			//Copy constructor
-			RBTreeIterator(const RBTreeIterator<T>& copy) : _node(copy.base()) {}
-			//Assignment operator
-			RBTreeIterator& operator=(const RBTreeIterator& copy)
-			{
-				if (this != &copy)
-					this->_node = copy.base();
-				return (*this);
-			}
+			//Copy constructor는 컴파일러가 만든 것을 사용하고, iterator -> const_iterator 변환만 정의한다.
+			//template이므로 copy constructor로 취급되지 않는다. (const_iterator -> iterator는 U를 추론할 수 없어 막힌다)
+			template <typename U>
+			RBTreeIterator(const RBTreeIterator<U, U*, U&, Node>& copy) : _node(copy.base()) {}
 			//Destructor
 			virtual ~RBTreeIterator() {}
 			//Getter
@@ -58,34 +143,16 @@ namespace ft
 			 */
 			reference operator*() const
 			{
-				return (*this->_node->value);
+				return (this->_node->value);
 			}
 			pointer operator->() const
 			{
-				return (this->_node->value);
+				return (&this->_node->value);
 			}
 
 			RBTreeIterator& operator++()
 			{
-				node_type* tmp = NULL;
-				if (_node->rightChild->value != NULL)
-				{	// if rightChild exists,
-					tmp = _node->rightChild;
-					// search the leftmost of the rightChild.
-					while (tmp->leftChild->value != NULL)
-						tmp = tmp->leftChild;
-				}
-				else
-				{	// if rightChild doesn't exist,
-					tmp = _node->parent;
-					if (tmp->rightChild == _node)
-					{	// if current node is rightChild,
-						while (tmp->parent->rightChild == tmp)
-							tmp = tmp->parent;
-						tmp = tmp->parent;
-					}
-				}
-				_node = tmp;
+				_node = RBTreeStep<node_type::threaded>::next(_node);
 				return (*this);
 			}
 
@@ -98,27 +165,7 @@ namespace ft
 
 			RBTreeIterator& operator--()
 			{
-				node_type* tmp = NULL;
-				if (_node->value == NULL)
-					tmp = _node->parent;
-				else if (_node->leftChild->value != NULL)
-				{	// if leftChild exists,
-					tmp = _node->leftChild;
-					// search the rightmost of the leftChild.
-					while (tmp->rightChild->value != NULL)
-						tmp = tmp->rightChild;
-				}
-				else
-				{	// if leftChild doesn't exist,
-					tmp = _node->parent;
-					if (tmp->leftChild == _node)
-					{	// if current node is leftChild,
-						while (tmp->parent->leftChild == tmp)
-							tmp = tmp->parent;
-						tmp = tmp->parent;
-					}
-				}
-				_node = tmp;
+				_node = RBTreeStep<node_type::threaded>::prev(_node);
 				return (*this);
 			}
 
@@ -2,74 +2,97 @@
 # define RBTREENODE_HPP
 
 #include <memory>
+#include <cstddef>
 
 /**
  * @brief Red-Black Tree Node
  *
  * Node에 필요한 요소
- * value
  * parent
  * left child
  * right child
  * color
+ * is_nil
+ * value
+ *
+ * value는 포인터로 따로 할당하지 않고 link 뒤에 노드 안에 직접 저장한다.
+ * -> 원소 하나당 할당은 노드 한 번, 탐색 시 link와 value가 같은 cache line에 놓인다.
+ * allocator는 노드마다 들고 있지 않고 tree가 하나만 가진다.
+ *
+ * nil노드는 value를 생성하지 않은 노드로, is_nil 플래그로 구분한다.
+ * -> nil노드는 tree에서 raw memory로 할당한 뒤 link/color/is_nil만 초기화하며, value는 생성/소멸하지 않는다.
+ *
+ * Counted = true 이면 노드를 root로 하는 서브트리의 노드 수(count)를 함께 저장한다. (order statistic tree)
+ * -> k번째 원소 찾기(select), key의 순위(rank), iterator 사이의 거리를 O(logN)으로 구할 수 있다.
+ * Counted = false 이면 count는 빈 base class가 되어 노드 크기가 늘지 않고, count 갱신은 아무 일도 하지 않는다.
+ *
+ * Threaded = true 이면 중위 순회의 이전/다음 노드(prev/next)를 함께 저장한다.
+ * -> nil노드를 head로 하는 원형 list가 되어 iterator의 ++/--가 포인터 하나를 읽는 것으로 끝난다.
+ * Threaded = false 이면 prev/next는 빈 base class가 되어 노드 크기가 늘지 않는다.
  */
 namespace ft
 {
 	enum RBColor { RED = false, BLACK = true };
 
-	template < typename T, typename Alloc = std::allocator<T> >
-	struct RBTreeNode {
+	//서브트리 노드 수를 저장하지 않는 노드. get_count/set_count는 아무 일도 하지 않는다.
+	template < bool Counted >
+	struct RBTreeNodeCount {
+		size_t get_count() const { return (0); }
+		void set_count(size_t) {}
+	};
+
+	//서브트리 노드 수를 저장하는 노드. nil노드의 count는 항상 0이다.
+	template <>
+	struct RBTreeNodeCount<true> {
+		size_t	count;
+
+		size_t get_count() const { return (this->count); }
+		void set_count(size_t n) { this->count = n; }
+	};
+
+	//중위 순회 link를 저장하지 않는 노드.
+	template < typename Node, bool Threaded >
+	struct RBTreeNodeThread {};
+
+	//중위 순회의 이전/다음 노드를 저장하는 노드.
+	template < typename Node >
+	struct RBTreeNodeThread<Node, true> {
+		Node*	prev;
+		Node*	next;
+	};
+
+	template < typename T, bool Counted = false, bool Threaded = false >
+	struct RBTreeNode : public RBTreeNodeCount<Counted>, public RBTreeNodeThread<RBTreeNode<T, Counted, Threaded>, Threaded> {
 	public :
 		typedef T	value_type;
 		typedef RBTreeNode*	node;
+		static const bool	threaded = Threaded;
 
-		value_type*	value;
 		node	parent;
 		node	leftChild;
 		node	rightChild;
 		RBColor	color;
-		Alloc	alloc;
-
-		//default
-		RBTreeNode() : value(NULL), parent(NULL), leftChild(NULL), rightChild(NULL), color(BLACK), alloc(Alloc()) {}
+		bool	is_nil;
+		value_type	value;
 
 		//initialization
-		RBTreeNode(const T& val) : value(NULL), parent(NULL), leftChild(NULL), rightChild(NULL), color(RED), alloc(Alloc())
-		{
-			value = alloc.allocate(1);
-			alloc.construct(value, val);
-		}
+		RBTreeNode(const T& val) : parent(NULL), leftChild(NULL), rightChild(NULL), color(RED), is_nil(false), value(val) {}
 
 		//copy
-		RBTreeNode(const RBTreeNode& copy) : value(NULL), parent(NULL), leftChild(NULL), rightChild(NULL), color(RED), alloc(Alloc())
-		{
-			if (copy.value != NULL)
-			{
-				value = alloc.allocate(1);
-				alloc.construct(value, *copy.value);
-				color = copy.color;
-			}
-		}
-
-		//destruct
-		~RBTreeNode()
-		{
-			if (value != NULL)
-			{
-				alloc.destroy(value);
-				alloc.deallocate(value, 1);
-			}
-		}
+		RBTreeNode(const RBTreeNode& copy) : RBTreeNodeCount<Counted>(copy), RBTreeNodeThread<RBTreeNode, Threaded>(), parent(NULL), leftChild(NULL), rightChild(NULL), color(copy.color), is_nil(copy.is_nil), value(copy.value) {}
 
 		bool operator==(const RBTreeNode& node) const
 		{
-			return (*this->value == *node->value);
+			return (this->value == node.value);
 		}
 
 		bool operator!=(const RBTreeNode& node) const
 		{
-			return (*this->value != *node->value);
+			return (this->value != node.value);
 		}
+
+	private :
+		RBTreeNode& operator=(const RBTreeNode&);
 	};
 } // namespace ft
 
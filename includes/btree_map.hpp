@@ -0,0 +1,486 @@
+#ifndef BTREE_MAP_HPP
+# define BTREE_MAP_HPP
+
+#include "BTree.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief btree_map class
+	 *
+	 * ft::map과 같은 interface를 가진 정렬된 연관 컨테이너.
+	 * RBTree 대신 한 노드에 여러 원소를 저장하는 BTree를 사용한다.
+	 * -> 탐색과 순회가 cache line 단위로 이루어지고, 원소당 메모리와 할당 횟수가 줄어든다.
+	 *
+	 * ft::map과 다른 점
+	 * - insert/erase 후에는 모든 iterator가 무효화된다. (원소가 노드 사이를 이동한다)
+	 * - key와 mapped_type이 노드 사이를 이동할 때 복사되므로, 복사 비용이 큰 타입에서는 insert/erase가 느려질 수 있다.
+	 *
+	 * @tparam Key	Type of the keys.(key_type)
+	 * @tparam T	Type of the mapped value.(mapped_type)
+	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.(key_compare)
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 * @tparam NodeBytes	노드 하나의 목표 크기(바이트). 기본값 256은 cache line 4개이다.
+	 */
+	template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator< ft::pair<const Key, T> >, size_t NodeBytes = 256 >
+	class btree_map {
+		public :
+			/**
+			 * @brief Member types
+			 */
+			typedef const Key	key_type;
+			typedef T	mapped_type;
+			typedef ft::pair<key_type, mapped_type>	value_type;
+			typedef Compare	key_compare;
+
+			//map::value_compare와 같다.
+			class value_compare : binary_function<value_type, value_type, bool>
+			{
+				friend class btree_map;
+				protected:
+					Compare comp;
+					value_compare(Compare c) : comp(c) {}
+				public:
+					typedef value_type	first_argument_type;
+					typedef value_type	second_argument_type;
+					typedef bool		result_type;
+					value_compare() : comp() {}
+					bool operator()(const value_type& lhs, const value_type& rhs) const
+					{
+						return (comp(lhs.first, rhs.first));
+					}
+					template <class K>
+					bool operator()(const value_type& lhs, const K& rhs) const
+					{
+						return (comp(lhs.first, rhs));
+					}
+					template <class K>
+					bool operator()(const K& lhs, const value_type& rhs) const
+					{
+						return (comp(lhs, rhs.first));
+					}
+			};
+			typedef Alloc	allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef ft::BTree<value_type, value_compare, allocator_type, NodeBytes>	b_tree;
+			typedef typename b_tree::iterator					iterator;
+			typedef typename b_tree::const_iterator				const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef typename allocator_type::size_type			size_type;
+
+		/**
+		 * @brief Member variables
+		 */
+		private:
+			b_tree			_tree;
+			key_compare		_comp;
+
+		public:
+			/**
+			 * @brief Member functions
+			 */
+			//Empty constructor
+			explicit btree_map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(value_compare(comp), alloc), _comp(comp) {}
+
+			//Range constructor
+			template <class InputIterator>
+			btree_map (InputIterator first, InputIterator last,
+					const key_compare& comp = key_compare(),
+					const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(value_compare(comp), alloc), _comp(comp)
+			{
+				insert(first, last);
+			}
+
+			//Copy constructor
+			//노드 구조를 그대로 복제한다. -> O(N)
+			btree_map (const btree_map& x) : _tree(x._tree), _comp(x._comp) {}
+
+			//Destructor
+			~btree_map() {}
+
+			//Assignment operator
+			btree_map& operator=(const btree_map& x)
+			{
+				if (this != &x)
+				{
+					this->_tree.copy(x._tree);
+					this->_comp = x._comp;
+				}
+				return *this;
+			}
+
+#ifdef FT_CXX11
+			//Move constructor
+			//x의 노드를 그대로 가져온다. -> O(1), x는 빈 btree_map이 된다.
+			btree_map (btree_map&& x) : _tree(std::move(x._tree)), _comp(x._comp) {}
+
+			//Move assignment operator
+			btree_map& operator=(btree_map&& x)
+			{
+				if (this != &x)
+				{
+					this->_tree = std::move(x._tree);
+					this->_comp = x._comp;
+				}
+				return *this;
+			}
+#endif
+
+			// Iterators:
+			iterator begin()
+			{
+				return (this->_tree.get_begin());
+			}
+			const_iterator begin() const
+			{
+				return (const_iterator(this->_tree.get_begin()));
+			}
+
+			iterator end()
+			{
+				return (this->_tree.get_end());
+			}
+			const_iterator end() const
+			{
+				return (const_iterator(this->_tree.get_end()));
+			}
+
+			reverse_iterator rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+			const_reverse_iterator rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+			const_reverse_iterator rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_tree.empty());
+			}
+			size_type size() const
+			{
+				return (this->_tree.size());
+			}
+			size_type max_size() const
+			{
+				return (this->_tree.max_size());
+			}
+
+			//Element access
+			//key가 이미 있으면 mapped_type을 만들지 않는다. 없으면 lower_bound를 hint로 삽입한다.
+			mapped_type& operator[](const key_type& k)
+			{
+				iterator it = this->_tree.lower_bound(k);
+				if (it == end() || this->_comp(k, it->first))
+					it = this->_tree.insert(value_type(k, mapped_type()), it).first;
+				return (it->second);
+			}
+
+			//Modifiers
+			pair<iterator, bool> insert(const value_type& val)
+			{
+				return (this->_tree.insert(val));
+			}
+
+			//position 바로 앞이 삽입 위치이면 탐색하지 않는다.
+			iterator insert(iterator position, const value_type& val)
+			{
+				return (this->_tree.insert(val, position).first);
+			}
+
+#ifdef FT_CXX11
+			//val을 slot 안으로 move한다.
+			pair<iterator, bool> insert(value_type&& val)
+			{
+				return (this->_tree.insert(std::move(val)));
+			}
+
+			iterator insert(iterator position, value_type&& val)
+			{
+				return (this->_tree.insert(std::move(val), position).first);
+			}
+
+			//원소가 노드 사이를 이동하므로 args로 value_type을 먼저 만들고 slot으로 move한다. (value_type은 move할 수 있어야 한다)
+			template <class... Args>
+			pair<iterator, bool> emplace(Args&&... args)
+			{
+				value_type val(std::forward<Args>(args)...);
+				return (this->_tree.insert(std::move(val)));
+			}
+
+			template <class... Args>
+			iterator emplace_hint(iterator position, Args&&... args)
+			{
+				value_type val(std::forward<Args>(args)...);
+				return (this->_tree.insert(std::move(val), position).first);
+			}
+
+			//key가 없을 때만 args로 mapped_type을 만든다. (c++17)
+			//lower_bound를 hint로 넘기므로 삽입할 때 다시 탐색하지 않는다.
+			template <class... Args>
+			pair<iterator, bool> try_emplace(const key_type& k, Args&&... args)
+			{
+				iterator it = this->_tree.lower_bound(k);
+				if (it != end() && !this->_comp(k, it->first))
+					return (ft::make_pair(it, false));
+				return (this->_tree.insert(value_type(ft::emplace_second, k, std::forward<Args>(args)...), it));
+			}
+
+			template <class... Args>
+			pair<iterator, bool> try_emplace(Key&& k, Args&&... args)
+			{
+				iterator it = this->_tree.lower_bound(k);
+				if (it != end() && !this->_comp(k, it->first))
+					return (ft::make_pair(it, false));
+				return (this->_tree.insert(value_type(ft::emplace_second, std::move(k), std::forward<Args>(args)...), it));
+			}
+#endif
+
+			//정렬된 입력은 가장 오른쪽 leaf에 이어 붙인다.
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last,
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				this->_tree.insert_range(first, last);
+			}
+
+			void erase(iterator position)
+			{
+				this->_tree.erase(position);
+			}
+
+			size_type erase(const key_type& k)
+			{
+				return (this->_tree.erase_key(k));
+			}
+
+			void erase(iterator first, iterator last)
+			{
+				this->_tree.erase_range(first, last);
+			}
+
+			void swap(btree_map& x)
+			{
+				key_compare tmp = this->_comp;
+				this->_tree.swap(x._tree);
+				this->_comp = x._comp;
+				x._comp = tmp;
+			}
+
+			void clear()
+			{
+				this->_tree.clear();
+			}
+
+			//Observers
+			key_compare key_comp() const
+			{
+				return (this->_comp);
+			}
+
+			value_compare value_comp() const
+			{
+				return (value_compare(this->_comp));
+			}
+
+			//Operations
+			iterator find(const key_type& k)
+			{
+				return (this->_tree.find(k));
+			}
+
+			const_iterator find(const key_type& k) const
+			{
+				return (const_iterator(this->_tree.find(k)));
+			}
+
+			//Compare가 is_transparent를 정의하면 key_type으로 변환하지 않고 k를 그대로 비교한다.
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type find(const K& k)
+			{
+				return (this->_tree.find(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type find(const K& k) const
+			{
+				return (const_iterator(this->_tree.find(k)));
+			}
+
+			size_type count(const key_type& k) const
+			{
+				return (find(k) != end() ? 1 : 0);
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type count(const K& k) const
+			{
+				return (find(k) != end() ? 1 : 0);
+			}
+
+			iterator lower_bound(const key_type& k)
+			{
+				return (this->_tree.lower_bound(k));
+			}
+
+			const_iterator lower_bound(const key_type& k) const
+			{
+				return (const_iterator(this->_tree.lower_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type lower_bound(const K& k)
+			{
+				return (this->_tree.lower_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type lower_bound(const K& k) const
+			{
+				return (const_iterator(this->_tree.lower_bound(k)));
+			}
+
+			iterator upper_bound(const key_type& k)
+			{
+				return (this->_tree.upper_bound(k));
+			}
+
+			const_iterator upper_bound(const key_type& k) const
+			{
+				return (const_iterator(this->_tree.upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type upper_bound(const K& k)
+			{
+				return (this->_tree.upper_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type upper_bound(const K& k) const
+			{
+				return (const_iterator(this->_tree.upper_bound(k)));
+			}
+
+			pair<iterator, iterator> equal_range(const key_type& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<iterator, iterator> >::type equal_range(const K& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<const_iterator, const_iterator> >::type equal_range(const K& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			//Allocator
+			allocator_type get_allocator() const
+			{
+				return (this->_tree.get_allocator());
+			}
+	};
+
+	/**
+	 * @brief Relational operators
+	 */
+	template <class Key, class T, class Compare, class Alloc, size_t NodeBytes>
+	bool operator==(const btree_map<Key, T, Compare, Alloc, NodeBytes>& lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, size_t NodeBytes>
+	bool operator!=(const btree_map<Key, T, Compare, Alloc, NodeBytes>& lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, size_t NodeBytes>
+	bool operator<(const btree_map<Key, T, Compare, Alloc, NodeBytes>& lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, size_t NodeBytes>
+	bool operator<=(const btree_map<Key, T, Compare, Alloc, NodeBytes>& lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, size_t NodeBytes>
+	bool operator>(const btree_map<Key, T, Compare, Alloc, NodeBytes>& lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class Key, class T, class Compare, class Alloc, size_t NodeBytes>
+	bool operator>=(const btree_map<Key, T, Compare, Alloc, NodeBytes>& lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	// swap
+	template <class Key, class T, class Compare, class Alloc, size_t NodeBytes>
+	void swap(btree_map<Key, T, Compare, Alloc, NodeBytes>& x, btree_map<Key, T, Compare, Alloc, NodeBytes>& y)
+	{
+		x.swap(y);
+	}
+
+	/**
+	 * @brief ft::btree
+	 *
+	 * 테스트에서 TESTED_NAMESPACE=ft::btree 로 map_test를 btree_map에 그대로 돌리기 위한 이름들.
+	 * c++98에는 alias template이 없으므로 btree_map을 상속해 생성자만 전달한다.
+	 */
+	namespace btree
+	{
+		using ft::pair;
+		using ft::make_pair;
+
+		template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator< ft::pair<const Key, T> > >
+		class map : public ft::btree_map<Key, T, Compare, Alloc>
+		{
+			private:
+				typedef ft::btree_map<Key, T, Compare, Alloc>	base;
+
+			public:
+				explicit map (const Compare& comp = Compare(), const Alloc& alloc = Alloc()) : base(comp, alloc) {}
+
+				template <class InputIterator>
+				map (InputIterator first, InputIterator last,
+						const Compare& comp = Compare(),
+						const Alloc& alloc = Alloc(),
+						typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : base(first, last, comp, alloc) {}
+		};
+	} // namespace btree
+} // namespace ft
+
+#endif
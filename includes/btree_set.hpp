@@ -0,0 +1,420 @@
+#ifndef BTREE_SET_HPP
+# define BTREE_SET_HPP
+
+#include "BTree.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief btree_set class
+	 *
+	 * ft::set과 같은 interface를 가진 정렬된 연관 컨테이너.
+	 * RBTree 대신 한 노드에 여러 원소를 저장하는 BTree를 사용한다. (btree_map 참고)
+	 * insert/erase 후에는 모든 iterator가 무효화된다.
+	 *
+	 * @tparam Key	Type of the keys.(key_type == value_type)
+	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.(key_compare)
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 * @tparam NodeBytes	노드 하나의 목표 크기(바이트). 기본값 256은 cache line 4개이다.
+	 */
+	template < class Key, class Compare = ft::less<Key>, class Alloc = std::allocator<Key>, size_t NodeBytes = 256 >
+	class btree_set {
+		public :
+			/**
+			 * @brief Member types
+			 */
+			typedef Key	key_type;
+			typedef Key	value_type;
+			typedef Compare	key_compare;
+			typedef Compare	value_compare;
+			typedef Alloc	allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef ft::BTree<value_type, value_compare, allocator_type, NodeBytes>	b_tree;
+			typedef typename b_tree::iterator					iterator;
+			typedef typename b_tree::const_iterator				const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef typename allocator_type::size_type			size_type;
+
+		/**
+		 * @brief Member variables
+		 */
+		private:
+			b_tree			_tree;
+			key_compare		_comp;
+
+		public:
+			/**
+			 * @brief Member functions
+			 */
+			//Empty constructor
+			explicit btree_set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(comp, alloc), _comp(comp) {}
+
+			//Range constructor
+			template <class InputIterator>
+			btree_set (InputIterator first, InputIterator last,
+					const key_compare& comp = key_compare(),
+					const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(comp, alloc), _comp(comp)
+			{
+				insert(first, last);
+			}
+
+			//Copy constructor
+			//노드 구조를 그대로 복제한다. -> O(N)
+			btree_set (const btree_set& x) : _tree(x._tree), _comp(x._comp) {}
+
+			//Destructor
+			~btree_set() {}
+
+			//Assignment operator
+			btree_set& operator=(const btree_set& x)
+			{
+				if (this != &x)
+				{
+					this->_tree.copy(x._tree);
+					this->_comp = x._comp;
+				}
+				return *this;
+			}
+
+#ifdef FT_CXX11
+			//Move constructor
+			//x의 노드를 그대로 가져온다. -> O(1), x는 빈 btree_set이 된다.
+			btree_set (btree_set&& x) : _tree(std::move(x._tree)), _comp(x._comp) {}
+
+			//Move assignment operator
+			btree_set& operator=(btree_set&& x)
+			{
+				if (this != &x)
+				{
+					this->_tree = std::move(x._tree);
+					this->_comp = x._comp;
+				}
+				return *this;
+			}
+#endif
+
+			// Iterators:
+			iterator begin()
+			{
+				return (this->_tree.get_begin());
+			}
+			const_iterator begin() const
+			{
+				return (const_iterator(this->_tree.get_begin()));
+			}
+
+			iterator end()
+			{
+				return (this->_tree.get_end());
+			}
+			const_iterator end() const
+			{
+				return (const_iterator(this->_tree.get_end()));
+			}
+
+			reverse_iterator rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+			const_reverse_iterator rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+			const_reverse_iterator rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_tree.empty());
+			}
+			size_type size() const
+			{
+				return (this->_tree.size());
+			}
+			size_type max_size() const
+			{
+				return (this->_tree.max_size());
+			}
+
+			//Modifiers
+			pair<iterator, bool> insert(const value_type& val)
+			{
+				return (this->_tree.insert(val));
+			}
+
+			//position 바로 앞이 삽입 위치이면 탐색하지 않는다.
+			iterator insert(iterator position, const value_type& val)
+			{
+				return (this->_tree.insert(val, position).first);
+			}
+
+#ifdef FT_CXX11
+			//val을 slot 안으로 move한다.
+			pair<iterator, bool> insert(value_type&& val)
+			{
+				return (this->_tree.insert(std::move(val)));
+			}
+
+			iterator insert(iterator position, value_type&& val)
+			{
+				return (this->_tree.insert(std::move(val), position).first);
+			}
+
+			//원소가 노드 사이를 이동하므로 args로 value_type을 먼저 만들고 slot으로 move한다.
+			template <class... Args>
+			pair<iterator, bool> emplace(Args&&... args)
+			{
+				value_type val(std::forward<Args>(args)...);
+				return (this->_tree.insert(std::move(val)));
+			}
+
+			template <class... Args>
+			iterator emplace_hint(iterator position, Args&&... args)
+			{
+				value_type val(std::forward<Args>(args)...);
+				return (this->_tree.insert(std::move(val), position).first);
+			}
+#endif
+
+			//정렬된 입력은 가장 오른쪽 leaf에 이어 붙인다.
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last,
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				this->_tree.insert_range(first, last);
+			}
+
+			void erase(iterator position)
+			{
+				this->_tree.erase(position);
+			}
+
+			size_type erase(const key_type& k)
+			{
+				return (this->_tree.erase_key(k));
+			}
+
+			void erase(iterator first, iterator last)
+			{
+				this->_tree.erase_range(first, last);
+			}
+
+			void swap(btree_set& x)
+			{
+				key_compare tmp = this->_comp;
+				this->_tree.swap(x._tree);
+				this->_comp = x._comp;
+				x._comp = tmp;
+			}
+
+			void clear()
+			{
+				this->_tree.clear();
+			}
+
+			//Observers
+			key_compare key_comp() const
+			{
+				return (this->_comp);
+			}
+
+			value_compare value_comp() const
+			{
+				return (this->_comp);
+			}
+
+			//Operations
+			iterator find(const key_type& k)
+			{
+				return (this->_tree.find(k));
+			}
+
+			const_iterator find(const key_type& k) const
+			{
+				return (const_iterator(this->_tree.find(k)));
+			}
+
+			//Compare가 is_transparent를 정의하면 key_type으로 변환하지 않고 k를 그대로 비교한다.
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type find(const K& k)
+			{
+				return (this->_tree.find(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type find(const K& k) const
+			{
+				return (const_iterator(this->_tree.find(k)));
+			}
+
+			size_type count(const key_type& k) const
+			{
+				return (find(k) != end() ? 1 : 0);
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type count(const K& k) const
+			{
+				return (find(k) != end() ? 1 : 0);
+			}
+
+			iterator lower_bound(const key_type& k)
+			{
+				return (this->_tree.lower_bound(k));
+			}
+
+			const_iterator lower_bound(const key_type& k) const
+			{
+				return (const_iterator(this->_tree.lower_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type lower_bound(const K& k)
+			{
+				return (this->_tree.lower_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type lower_bound(const K& k) const
+			{
+				return (const_iterator(this->_tree.lower_bound(k)));
+			}
+
+			iterator upper_bound(const key_type& k)
+			{
+				return (this->_tree.upper_bound(k));
+			}
+
+			const_iterator upper_bound(const key_type& k) const
+			{
+				return (const_iterator(this->_tree.upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type upper_bound(const K& k)
+			{
+				return (this->_tree.upper_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type upper_bound(const K& k) const
+			{
+				return (const_iterator(this->_tree.upper_bound(k)));
+			}
+
+			pair<iterator, iterator> equal_range(const key_type& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<iterator, iterator> >::type equal_range(const K& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<const_iterator, const_iterator> >::type equal_range(const K& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			//Allocator
+			allocator_type get_allocator() const
+			{
+				return (this->_tree.get_allocator());
+			}
+	};
+
+	/**
+	 * @brief Relational operators
+	 */
+	template <class Key, class Compare, class Alloc, size_t NodeBytes>
+	bool operator==(const btree_set<Key, Compare, Alloc, NodeBytes>& lhs, const btree_set<Key, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class Compare, class Alloc, size_t NodeBytes>
+	bool operator!=(const btree_set<Key, Compare, Alloc, NodeBytes>& lhs, const btree_set<Key, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class Compare, class Alloc, size_t NodeBytes>
+	bool operator<(const btree_set<Key, Compare, Alloc, NodeBytes>& lhs, const btree_set<Key, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class Compare, class Alloc, size_t NodeBytes>
+	bool operator<=(const btree_set<Key, Compare, Alloc, NodeBytes>& lhs, const btree_set<Key, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class Compare, class Alloc, size_t NodeBytes>
+	bool operator>(const btree_set<Key, Compare, Alloc, NodeBytes>& lhs, const btree_set<Key, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class Key, class Compare, class Alloc, size_t NodeBytes>
+	bool operator>=(const btree_set<Key, Compare, Alloc, NodeBytes>& lhs, const btree_set<Key, Compare, Alloc, NodeBytes>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	// swap
+	template <class Key, class Compare, class Alloc, size_t NodeBytes>
+	void swap(btree_set<Key, Compare, Alloc, NodeBytes>& x, btree_set<Key, Compare, Alloc, NodeBytes>& y)
+	{
+		x.swap(y);
+	}
+
+	/**
+	 * @brief ft::btree
+	 *
+	 * 테스트에서 TESTED_NAMESPACE=ft::btree 로 set_test를 btree_set에 그대로 돌리기 위한 이름들.
+	 * c++98에는 alias template이 없으므로 btree_set을 상속해 생성자만 전달한다.
+	 */
+	namespace btree
+	{
+		template < class Key, class Compare = ft::less<Key>, class Alloc = std::allocator<Key> >
+		class set : public ft::btree_set<Key, Compare, Alloc>
+		{
+			private:
+				typedef ft::btree_set<Key, Compare, Alloc>	base;
+
+			public:
+				explicit set (const Compare& comp = Compare(), const Alloc& alloc = Alloc()) : base(comp, alloc) {}
+
+				template <class InputIterator>
+				set (InputIterator first, InputIterator last,
+						const Compare& comp = Compare(),
+						const Alloc& alloc = Alloc(),
+						typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : base(first, last, comp, alloc) {}
+		};
+	} // namespace btree
+} // namespace ft
+
+#endif
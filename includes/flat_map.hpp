@@ -0,0 +1,472 @@
+#ifndef FLAT_MAP_HPP
+# define FLAT_MAP_HPP
+
+#include "FlatTree.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief flat_map class
+	 *
+	 * ft::map과 같은 interface를 가진 정렬된 연관 컨테이너.
+	 * RBTree 대신 key 순서로 정렬된 ft::vector 하나에 원소를 저장한다. (FlatTree)
+	 * -> 노드가 없어 메모리가 원소 크기뿐이고, 탐색은 이진 탐색, 순회는 배열을 차례로 읽는다.
+	 *
+	 * 한 번 만들고 조회만 하는 map을 위한 컨테이너이다.
+	 * - range 생성자와 range insert는 한 번 정렬/중복 제거하고 기존 원소와 병합한다. -> 원소를 모아서 넣는다.
+	 * - 하나씩 insert/erase하면 뒤쪽 원소를 모두 옮기므로 O(N)이다.
+	 * - insert/erase 후에는 모든 iterator가 무효화된다.
+	 *
+	 * @tparam Key	Type of the keys.(key_type)
+	 * @tparam T	Type of the mapped value.(mapped_type)
+	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.(key_compare)
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 */
+	template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator< ft::pair<const Key, T> > >
+	class flat_map {
+		public :
+			/**
+			 * @brief Member types
+			 */
+			typedef const Key	key_type;
+			typedef T	mapped_type;
+			typedef ft::pair<key_type, mapped_type>	value_type;
+			typedef Compare	key_compare;
+
+			//map::value_compare와 같다.
+			class value_compare : binary_function<value_type, value_type, bool>
+			{
+				friend class flat_map;
+				protected:
+					Compare comp;
+					value_compare(Compare c) : comp(c) {}
+				public:
+					typedef value_type	first_argument_type;
+					typedef value_type	second_argument_type;
+					typedef bool		result_type;
+					value_compare() : comp() {}
+					bool operator()(const value_type& lhs, const value_type& rhs) const
+					{
+						return (comp(lhs.first, rhs.first));
+					}
+					template <class K>
+					bool operator()(const value_type& lhs, const K& rhs) const
+					{
+						return (comp(lhs.first, rhs));
+					}
+					template <class K>
+					bool operator()(const K& lhs, const value_type& rhs) const
+					{
+						return (comp(lhs, rhs.first));
+					}
+			};
+			typedef Alloc	allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef ft::FlatTree<value_type, value_compare, allocator_type>	flat_tree;
+			typedef typename flat_tree::iterator					iterator;
+			typedef typename flat_tree::const_iterator				const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef typename allocator_type::size_type			size_type;
+
+		/**
+		 * @brief Member variables
+		 */
+		private:
+			flat_tree		_tree;
+			key_compare		_comp;
+
+		public:
+			/**
+			 * @brief Member functions
+			 */
+			//Empty constructor
+			explicit flat_map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(value_compare(comp), alloc), _comp(comp) {}
+
+			//Range constructor
+			template <class InputIterator>
+			flat_map (InputIterator first, InputIterator last,
+					const key_compare& comp = key_compare(),
+					const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(value_compare(comp), alloc), _comp(comp)
+			{
+				insert(first, last);
+			}
+
+			//Copy constructor
+			flat_map (const flat_map& x) : _tree(x._tree), _comp(x._comp) {}
+
+			//Destructor
+			~flat_map() {}
+
+			//Assignment operator
+			flat_map& operator=(const flat_map& x)
+			{
+				if (this != &x)
+				{
+					this->_tree = x._tree;
+					this->_comp = x._comp;
+				}
+				return *this;
+			}
+
+#ifdef FT_CXX11
+			//Move constructor
+			//x의 배열을 그대로 가져온다. -> O(1), x는 빈 flat_map이 된다.
+			flat_map (flat_map&& x) : _tree(std::move(x._tree)), _comp(x._comp) {}
+
+			//Move assignment operator
+			flat_map& operator=(flat_map&& x)
+			{
+				if (this != &x)
+				{
+					this->_tree = std::move(x._tree);
+					this->_comp = x._comp;
+				}
+				return *this;
+			}
+#endif
+
+			// Iterators:
+			iterator begin()
+			{
+				return (this->_tree.begin());
+			}
+			const_iterator begin() const
+			{
+				return (this->_tree.begin());
+			}
+
+			iterator end()
+			{
+				return (this->_tree.end());
+			}
+			const_iterator end() const
+			{
+				return (this->_tree.end());
+			}
+
+			reverse_iterator rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+			const_reverse_iterator rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+			const_reverse_iterator rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_tree.empty());
+			}
+			size_type size() const
+			{
+				return (this->_tree.size());
+			}
+			size_type max_size() const
+			{
+				return (this->_tree.max_size());
+			}
+
+			//원소 n개를 재할당 없이 담을 수 있도록 한다.
+			size_type capacity() const
+			{
+				return (this->_tree.capacity());
+			}
+			void reserve(size_type n)
+			{
+				this->_tree.reserve(n);
+			}
+
+			//Element access
+			//key가 이미 있으면 mapped_type을 만들지 않는다. 없으면 lower_bound를 hint로 삽입한다.
+			mapped_type& operator[](const key_type& k)
+			{
+				size_type i = this->_tree.lower_bound(k);
+				if (i == size() || this->_comp(k, this->_tree[i].first))
+					i = this->_tree.insert(value_type(k, mapped_type()), i).first;
+				return (this->_tree[i].second);
+			}
+
+			//Modifiers
+			//뒤쪽 원소를 한 칸씩 옮긴다. -> O(N)
+			pair<iterator, bool> insert(const value_type& val)
+			{
+				ft::pair<size_type, bool> res = this->_tree.insert(val);
+				return (ft::make_pair(begin() + res.first, res.second));
+			}
+
+			//position 바로 앞이 삽입 위치이면 탐색하지 않는다.
+			iterator insert(iterator position, const value_type& val)
+			{
+				return (begin() + this->_tree.insert(val, position - begin()).first);
+			}
+
+#ifdef FT_CXX11
+			//val을 배열 안으로 move한다.
+			pair<iterator, bool> insert(value_type&& val)
+			{
+				ft::pair<size_type, bool> res = this->_tree.insert(std::move(val));
+				return (ft::make_pair(begin() + res.first, res.second));
+			}
+
+			iterator insert(iterator position, value_type&& val)
+			{
+				return (begin() + this->_tree.insert(std::move(val), position - begin()).first);
+			}
+
+			//key를 비교하려면 먼저 만들어야 하므로 args로 value_type을 만든 뒤 배열로 move한다.
+			template <class... Args>
+			pair<iterator, bool> emplace(Args&&... args)
+			{
+				value_type val(std::forward<Args>(args)...);
+				return (insert(std::move(val)));
+			}
+
+			template <class... Args>
+			iterator emplace_hint(iterator position, Args&&... args)
+			{
+				value_type val(std::forward<Args>(args)...);
+				return (insert(position, std::move(val)));
+			}
+
+			//key가 없을 때만 args로 mapped_type을 만든다. (c++17)
+			//lower_bound의 index를 hint로 넘기므로 삽입할 때 다시 탐색하지 않는다.
+			template <class... Args>
+			pair<iterator, bool> try_emplace(const key_type& k, Args&&... args)
+			{
+				size_type i = this->_tree.lower_bound(k);
+				if (i < size() && !this->_comp(k, this->_tree[i].first))
+					return (ft::make_pair(begin() + i, false));
+				i = this->_tree.insert(value_type(ft::emplace_second, k, std::forward<Args>(args)...), i).first;
+				return (ft::make_pair(begin() + i, true));
+			}
+
+			template <class... Args>
+			pair<iterator, bool> try_emplace(Key&& k, Args&&... args)
+			{
+				size_type i = this->_tree.lower_bound(k);
+				if (i < size() && !this->_comp(k, this->_tree[i].first))
+					return (ft::make_pair(begin() + i, false));
+				i = this->_tree.insert(value_type(ft::emplace_second, std::move(k), std::forward<Args>(args)...), i).first;
+				return (ft::make_pair(begin() + i, true));
+			}
+#endif
+
+			//batch insert: 새 원소만 정렬해 기존 원소와 한 번에 병합한다. -> O(M logM + N)
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last,
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				this->_tree.insert_range(first, last);
+			}
+
+			void erase(iterator position)
+			{
+				this->_tree.erase(position - begin());
+			}
+
+			size_type erase(const key_type& k)
+			{
+				return (this->_tree.erase_key(k));
+			}
+
+			void erase(iterator first, iterator last)
+			{
+				this->_tree.erase_range(first - begin(), last - begin());
+			}
+
+			void swap(flat_map& x)
+			{
+				key_compare tmp = this->_comp;
+				this->_tree.swap(x._tree);
+				this->_comp = x._comp;
+				x._comp = tmp;
+			}
+
+			void clear()
+			{
+				this->_tree.clear();
+			}
+
+			//Observers
+			key_compare key_comp() const
+			{
+				return (this->_comp);
+			}
+
+			value_compare value_comp() const
+			{
+				return (value_compare(this->_comp));
+			}
+
+			//Operations
+			iterator find(const key_type& k)
+			{
+				return (begin() + this->_tree.find(k));
+			}
+
+			const_iterator find(const key_type& k) const
+			{
+				return (begin() + this->_tree.find(k));
+			}
+
+			//Compare가 is_transparent를 정의하면 key_type으로 변환하지 않고 k를 그대로 비교한다.
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type find(const K& k)
+			{
+				return (begin() + this->_tree.find(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type find(const K& k) const
+			{
+				return (begin() + this->_tree.find(k));
+			}
+
+			size_type count(const key_type& k) const
+			{
+				return (find(k) != end() ? 1 : 0);
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type count(const K& k) const
+			{
+				return (find(k) != end() ? 1 : 0);
+			}
+
+			iterator lower_bound(const key_type& k)
+			{
+				return (begin() + this->_tree.lower_bound(k));
+			}
+
+			const_iterator lower_bound(const key_type& k) const
+			{
+				return (begin() + this->_tree.lower_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type lower_bound(const K& k)
+			{
+				return (begin() + this->_tree.lower_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type lower_bound(const K& k) const
+			{
+				return (begin() + this->_tree.lower_bound(k));
+			}
+
+			iterator upper_bound(const key_type& k)
+			{
+				return (begin() + this->_tree.upper_bound(k));
+			}
+
+			const_iterator upper_bound(const key_type& k) const
+			{
+				return (begin() + this->_tree.upper_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type upper_bound(const K& k)
+			{
+				return (begin() + this->_tree.upper_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type upper_bound(const K& k) const
+			{
+				return (begin() + this->_tree.upper_bound(k));
+			}
+
+			pair<iterator, iterator> equal_range(const key_type& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<iterator, iterator> >::type equal_range(const K& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<const_iterator, const_iterator> >::type equal_range(const K& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			//Allocator
+			allocator_type get_allocator() const
+			{
+				return (this->_tree.get_allocator());
+			}
+	};
+
+	/**
+	 * @brief Relational operators
+	 */
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator==(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator!=(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<=(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>=(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	// swap
+	template <class Key, class T, class Compare, class Alloc>
+	void swap(flat_map<Key, T, Compare, Alloc>& x, flat_map<Key, T, Compare, Alloc>& y)
+	{
+		x.swap(y);
+	}
+} // namespace ft
+
+#endif
@@ -0,0 +1,406 @@
+#ifndef FLAT_SET_HPP
+# define FLAT_SET_HPP
+
+#include "FlatTree.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief flat_set class
+	 *
+	 * ft::set과 같은 interface를 가진 정렬된 연관 컨테이너.
+	 * RBTree 대신 정렬된 ft::vector 하나에 원소를 저장한다. (flat_map 참고)
+	 * insert/erase 후에는 모든 iterator가 무효화된다.
+	 *
+	 * @tparam Key	Type of the keys.(key_type == value_type)
+	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.(key_compare)
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 */
+	template < class Key, class Compare = ft::less<Key>, class Alloc = std::allocator<Key> >
+	class flat_set {
+		public :
+			/**
+			 * @brief Member types
+			 */
+			typedef Key	key_type;
+			typedef Key	value_type;
+			typedef Compare	key_compare;
+			typedef Compare	value_compare;
+			typedef Alloc	allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef ft::FlatTree<value_type, value_compare, allocator_type>	flat_tree;
+			typedef typename flat_tree::iterator					iterator;
+			typedef typename flat_tree::const_iterator				const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef typename allocator_type::size_type			size_type;
+
+		/**
+		 * @brief Member variables
+		 */
+		private:
+			flat_tree		_tree;
+			key_compare		_comp;
+
+		public:
+			/**
+			 * @brief Member functions
+			 */
+			//Empty constructor
+			explicit flat_set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(comp, alloc), _comp(comp) {}
+
+			//Range constructor
+			template <class InputIterator>
+			flat_set (InputIterator first, InputIterator last,
+					const key_compare& comp = key_compare(),
+					const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(comp, alloc), _comp(comp)
+			{
+				insert(first, last);
+			}
+
+			//Copy constructor
+			flat_set (const flat_set& x) : _tree(x._tree), _comp(x._comp) {}
+
+			//Destructor
+			~flat_set() {}
+
+			//Assignment operator
+			flat_set& operator=(const flat_set& x)
+			{
+				if (this != &x)
+				{
+					this->_tree = x._tree;
+					this->_comp = x._comp;
+				}
+				return *this;
+			}
+
+#ifdef FT_CXX11
+			//Move constructor
+			//x의 배열을 그대로 가져온다. -> O(1), x는 빈 flat_set이 된다.
+			flat_set (flat_set&& x) : _tree(std::move(x._tree)), _comp(x._comp) {}
+
+			//Move assignment operator
+			flat_set& operator=(flat_set&& x)
+			{
+				if (this != &x)
+				{
+					this->_tree = std::move(x._tree);
+					this->_comp = x._comp;
+				}
+				return *this;
+			}
+#endif
+
+			// Iterators:
+			iterator begin()
+			{
+				return (this->_tree.begin());
+			}
+			const_iterator begin() const
+			{
+				return (this->_tree.begin());
+			}
+
+			iterator end()
+			{
+				return (this->_tree.end());
+			}
+			const_iterator end() const
+			{
+				return (this->_tree.end());
+			}
+
+			reverse_iterator rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+			const_reverse_iterator rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+			const_reverse_iterator rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_tree.empty());
+			}
+			size_type size() const
+			{
+				return (this->_tree.size());
+			}
+			size_type max_size() const
+			{
+				return (this->_tree.max_size());
+			}
+
+			//원소 n개를 재할당 없이 담을 수 있도록 한다.
+			size_type capacity() const
+			{
+				return (this->_tree.capacity());
+			}
+			void reserve(size_type n)
+			{
+				this->_tree.reserve(n);
+			}
+
+			//Modifiers
+			//뒤쪽 원소를 한 칸씩 옮긴다. -> O(N)
+			pair<iterator, bool> insert(const value_type& val)
+			{
+				ft::pair<size_type, bool> res = this->_tree.insert(val);
+				return (ft::make_pair(begin() + res.first, res.second));
+			}
+
+			//position 바로 앞이 삽입 위치이면 탐색하지 않는다.
+			iterator insert(iterator position, const value_type& val)
+			{
+				return (begin() + this->_tree.insert(val, position - begin()).first);
+			}
+
+#ifdef FT_CXX11
+			//val을 배열 안으로 move한다.
+			pair<iterator, bool> insert(value_type&& val)
+			{
+				ft::pair<size_type, bool> res = this->_tree.insert(std::move(val));
+				return (ft::make_pair(begin() + res.first, res.second));
+			}
+
+			iterator insert(iterator position, value_type&& val)
+			{
+				return (begin() + this->_tree.insert(std::move(val), position - begin()).first);
+			}
+
+			//key를 비교하려면 먼저 만들어야 하므로 args로 value_type을 만든 뒤 배열로 move한다.
+			template <class... Args>
+			pair<iterator, bool> emplace(Args&&... args)
+			{
+				value_type val(std::forward<Args>(args)...);
+				return (insert(std::move(val)));
+			}
+
+			template <class... Args>
+			iterator emplace_hint(iterator position, Args&&... args)
+			{
+				value_type val(std::forward<Args>(args)...);
+				return (insert(position, std::move(val)));
+			}
+#endif
+
+			//batch insert: 새 원소만 정렬해 기존 원소와 한 번에 병합한다. -> O(M logM + N)
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last,
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				this->_tree.insert_range(first, last);
+			}
+
+			void erase(iterator position)
+			{
+				this->_tree.erase(position - begin());
+			}
+
+			size_type erase(const key_type& k)
+			{
+				return (this->_tree.erase_key(k));
+			}
+
+			void erase(iterator first, iterator last)
+			{
+				this->_tree.erase_range(first - begin(), last - begin());
+			}
+
+			void swap(flat_set& x)
+			{
+				key_compare tmp = this->_comp;
+				this->_tree.swap(x._tree);
+				this->_comp = x._comp;
+				x._comp = tmp;
+			}
+
+			void clear()
+			{
+				this->_tree.clear();
+			}
+
+			//Observers
+			key_compare key_comp() const
+			{
+				return (this->_comp);
+			}
+
+			value_compare value_comp() const
+			{
+				return (this->_comp);
+			}
+
+			//Operations
+			iterator find(const key_type& k)
+			{
+				return (begin() + this->_tree.find(k));
+			}
+
+			const_iterator find(const key_type& k) const
+			{
+				return (begin() + this->_tree.find(k));
+			}
+
+			//Compare가 is_transparent를 정의하면 key_type으로 변환하지 않고 k를 그대로 비교한다.
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type find(const K& k)
+			{
+				return (begin() + this->_tree.find(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type find(const K& k) const
+			{
+				return (begin() + this->_tree.find(k));
+			}
+
+			size_type count(const key_type& k) const
+			{
+				return (find(k) != end() ? 1 : 0);
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type count(const K& k) const
+			{
+				return (find(k) != end() ? 1 : 0);
+			}
+
+			iterator lower_bound(const key_type& k)
+			{
+				return (begin() + this->_tree.lower_bound(k));
+			}
+
+			const_iterator lower_bound(const key_type& k) const
+			{
+				return (begin() + this->_tree.lower_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type lower_bound(const K& k)
+			{
+				return (begin() + this->_tree.lower_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type lower_bound(const K& k) const
+			{
+				return (begin() + this->_tree.lower_bound(k));
+			}
+
+			iterator upper_bound(const key_type& k)
+			{
+				return (begin() + this->_tree.upper_bound(k));
+			}
+
+			const_iterator upper_bound(const key_type& k) const
+			{
+				return (begin() + this->_tree.upper_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type upper_bound(const K& k)
+			{
+				return (begin() + this->_tree.upper_bound(k));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type upper_bound(const K& k) const
+			{
+				return (begin() + this->_tree.upper_bound(k));
+			}
+
+			pair<iterator, iterator> equal_range(const key_type& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<iterator, iterator> >::type equal_range(const K& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<const_iterator, const_iterator> >::type equal_range(const K& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			//Allocator
+			allocator_type get_allocator() const
+			{
+				return (this->_tree.get_allocator());
+			}
+	};
+
+	/**
+	 * @brief Relational operators
+	 */
+	template <class Key, class Compare, class Alloc>
+	bool operator==(const flat_set<Key, Compare, Alloc>& lhs, const flat_set<Key, Compare, Alloc>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool operator!=(const flat_set<Key, Compare, Alloc>& lhs, const flat_set<Key, Compare, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool operator<(const flat_set<Key, Compare, Alloc>& lhs, const flat_set<Key, Compare, Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool operator<=(const flat_set<Key, Compare, Alloc>& lhs, const flat_set<Key, Compare, Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool operator>(const flat_set<Key, Compare, Alloc>& lhs, const flat_set<Key, Compare, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool operator>=(const flat_set<Key, Compare, Alloc>& lhs, const flat_set<Key, Compare, Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	// swap
+	template <class Key, class Compare, class Alloc>
+	void swap(flat_set<Key, Compare, Alloc>& x, flat_set<Key, Compare, Alloc>& y)
+	{
+		x.swap(y);
+	}
+} // namespace ft
+
+#endif
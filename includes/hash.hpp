@@ -0,0 +1,121 @@
+#ifndef HASH_HPP
+# define HASH_HPP
+
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief hash
+ * unordered_map/unordered_set의 기본 hasher. (c++11 std::hash)
+ * 정수와 포인터는 값을 그대로 반환하고, std::string은 FNV-1a를 사용한다.
+ * 비트를 섞는 것은 HashTable이 한 번 더 하므로 여기서는 하지 않는다.
+ * 특수화되지 않은 타입은 정의가 없어 compile error가 난다.
+ */
+namespace ft
+{
+	template <class T>
+	struct hash;
+
+	template <class T>
+	struct integral_hash
+	{
+		typedef T		argument_type;
+		typedef size_t	result_type;
+
+		size_t operator()(T x) const
+		{
+			return (static_cast<size_t>(x));
+		}
+	};
+
+	// template 특수화
+	template <>
+	struct hash<bool> : public integral_hash<bool> {};
+
+	template <>
+	struct hash<char> : public integral_hash<char> {};
+
+	template <>
+	struct hash<signed char> : public integral_hash<signed char> {};
+
+	template <>
+	struct hash<wchar_t> : public integral_hash<wchar_t> {};
+
+	template <>
+	struct hash<short int> : public integral_hash<short int> {};
+
+	template <>
+	struct hash<int> : public integral_hash<int> {};
+
+	template <>
+	struct hash<long int> : public integral_hash<long int> {};
+
+	template <>
+	struct hash<long long int> : public integral_hash<long long int> {};
+
+	template <>
+	struct hash<unsigned char> : public integral_hash<unsigned char> {};
+
+	template <>
+	struct hash<unsigned short> : public integral_hash<unsigned short> {};
+
+	template <>
+	struct hash<unsigned int> : public integral_hash<unsigned int> {};
+
+	template <>
+	struct hash<unsigned long int> : public integral_hash<unsigned long int> {};
+
+	template <>
+	struct hash<unsigned long long int> : public integral_hash<unsigned long long int> {};
+
+	//포인터는 주소 값
+	template <class T>
+	struct hash<T*>
+	{
+		typedef T*		argument_type;
+		typedef size_t	result_type;
+
+		size_t operator()(T* p) const
+		{
+			return (reinterpret_cast<size_t>(p));
+		}
+	};
+
+	//FNV-1a
+	template <>
+	struct hash<std::string>
+	{
+		typedef std::string	argument_type;
+		typedef size_t		result_type;
+
+		size_t operator()(const std::string& s) const
+		{
+			size_t h = static_cast<size_t>(14695981039346656037ULL);
+			for (std::string::size_type i = 0; i < s.size(); ++i)
+			{
+				h ^= static_cast<unsigned char>(s[i]);
+				h *= static_cast<size_t>(1099511628211ULL);
+			}
+			return (h);
+		}
+	};
+
+	/**
+	 * @brief equal_to
+	 * operator==를 적용하는 비교 객체. unordered_map/unordered_set의 기본 key_equal
+	 */
+	template <class T>
+	struct equal_to
+	{
+		typedef T		first_argument_type;
+		typedef T		second_argument_type;
+		typedef bool	result_type;
+
+		bool operator()(const T& x, const T& y) const
+		{
+			return (x == y);
+		}
+	};
+} // namespace ft
+
+#endif
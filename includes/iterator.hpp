@@ -1,7 +1,7 @@
 #ifndef ITERATOR_HPP
 # define ITERATOR_HPP
 
-// #include <iterator>
+#include <iterator>
 #include <cstddef>
 
 /**
@@ -93,6 +93,63 @@ namespace ft
 		typedef const T& reference;
 	};
 
+	/**
+	 * @brief iterator_category_tag
+	 * iterator_category를 ft의 tag로 바꾼다. tag dispatch(ft::distance, ft::advance, vector의 range 함수)에 쓴다.
+	 * std container와 stream의 iterator는 std의 tag를 가지므로, 같은 category의 ft tag로 대응시킨다.
+	 */
+	template <class Category>
+	struct iterator_category_tag
+	{
+		typedef Category	type;
+	};
+
+	template <>
+	struct iterator_category_tag<std::input_iterator_tag>
+	{
+		typedef input_iterator_tag	type;
+	};
+
+	template <>
+	struct iterator_category_tag<std::output_iterator_tag>
+	{
+		typedef output_iterator_tag	type;
+	};
+
+	template <>
+	struct iterator_category_tag<std::forward_iterator_tag>
+	{
+		typedef forward_iterator_tag	type;
+	};
+
+	template <>
+	struct iterator_category_tag<std::bidirectional_iterator_tag>
+	{
+		typedef bidirectional_iterator_tag	type;
+	};
+
+	template <>
+	struct iterator_category_tag<std::random_access_iterator_tag>
+	{
+		typedef random_access_iterator_tag	type;
+	};
+
+#if __cplusplus > 201703L
+	template <>
+	struct iterator_category_tag<std::contiguous_iterator_tag>
+	{
+		typedef random_access_iterator_tag	type;
+	};
+#endif
+
+	//tag 객체를 만들어 overload를 고른다. ex) ft::distance(first, last, ft::iterator_category(first))
+	template <class Iterator>
+	typename iterator_category_tag<typename iterator_traits<Iterator>::iterator_category>::type
+	iterator_category(const Iterator&)
+	{
+		return (typename iterator_category_tag<typename iterator_traits<Iterator>::iterator_category>::type());
+	}
+
 	/**
 	 * @brief iterator
 	 * iterator 클래스를 파생하는데 사용할 수 있는 기본 클래스 템플릿
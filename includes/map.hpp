@@ -29,8 +29,10 @@ namespace ft
 	 * @tparam T	Type of the mapped value.(mapped_type)
 	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.(key_compare)
 	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 * @tparam OrderStatistic	true이면 select(k)/rank(k)와 O(logN) iterator 거리(ft::distance)를 제공한다. 기본값 false는 추가 비용이 없다.
+	 * @tparam Threaded	true이면 노드가 중위 순회의 prev/next를 가져 iterator의 ++/--가 O(1)이 된다. 기본값 false는 추가 비용이 없다.
 	 */
-	template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator< ft::pair<const Key, T> > >
+	template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator< ft::pair<const Key, T> >, bool OrderStatistic = false, bool Threaded = false >
 	class map {
 		public :
 			/**
@@ -50,6 +52,7 @@ namespace ft
 			 */
 			class value_compare : binary_function<value_type, value_type, bool>
 			{
+				friend class map;
 				protected:
 					Compare comp;
 					value_compare(Compare c) : comp(c) {}
@@ -65,20 +68,31 @@ namespace ft
 					{
 						return (comp(lhs.first, rhs.first));
 					}
+					//value의 key와 다른 key를 직접 비교한다. -> tree에서 lookup할 때 value_type을 만들지 않는다.
+					template <class K>
+					bool operator()(const value_type& lhs, const K& rhs) const
+					{
+						return (comp(lhs.first, rhs));
+					}
+					template <class K>
+					bool operator()(const K& lhs, const value_type& rhs) const
+					{
+						return (comp(lhs, rhs.first));
+					}
 			};
 			typedef Alloc	allocator_type;
 			typedef typename allocator_type::reference			reference;
 			typedef typename allocator_type::const_reference	const_reference;
 			typedef typename allocator_type::pointer			pointer;
 			typedef typename allocator_type::const_pointer		const_pointer;
-			typedef typename ft::RBTreeIterator<value_type, value_type*, value_type&>	iterator;
-			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&>	const_iterator;
+			typedef ft::RBTree<value_type, value_compare, allocator_type, OrderStatistic, Threaded>	rb_tree;
+			typedef typename rb_tree::node_type					node_type;
+			typedef typename rb_tree::iterator					iterator;
+			typedef typename rb_tree::const_iterator			const_iterator;
 			typedef ft::reverse_iterator<iterator>				reverse_iterator;
 			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
 			typedef typename allocator_type::difference_type	difference_type;
 			typedef typename allocator_type::size_type			size_type;
-			typedef ft::RBTree<value_type, value_compare>		rb_tree;
-			typedef ft::RBTreeNode<value_type>					node_type;
 
 		/**
 		 * @brief Member variables
@@ -93,7 +107,7 @@ namespace ft
 			 * @brief Member functions
 			 */
 			//Empty constructor
-			explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _tree(), _comp(comp) {}
+			explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _tree(value_compare(comp), alloc), _comp(comp) {}
 
 			//Range constructor
 			//[first,last) 범위와 동일한 수의 요소로 컨테이너를 구성하고 각 요소는 해당 범위의 해당 요소로 구성한다
@@ -101,17 +115,15 @@ namespace ft
 			map (InputIterator first, InputIterator last,
 					const key_compare& comp = key_compare(),
 					const allocator_type& alloc = allocator_type(),
-					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _alloc(alloc), _tree(), _comp(comp)
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _alloc(alloc), _tree(value_compare(comp), alloc), _comp(comp)
 			{
 				insert(first, last);
 			}
 
 			//Copy constructor
 			//x에 있는 각 요소의 복사본을 사용하여 컨테이너를 구성한다
-			map (const map& x) : _alloc(x._alloc), _tree(), _comp(x._comp)
-			{
-				*this = x;
-			}
+			//tree의 모양과 색을 그대로 복제한다. -> O(N)
+			map (const map& x) : _alloc(x._alloc), _tree(x._tree), _comp(x._comp) {}
 
 			//Destructor
 			~map() {}
@@ -124,6 +136,20 @@ namespace ft
 				return *this;
 			}
 
+#ifdef FT_CXX11
+			//Move constructor
+			//x의 노드를 그대로 가져온다. -> O(1), x는 빈 map이 된다.
+			map (map&& x) : _alloc(x._alloc), _tree(std::move(x._tree)), _comp(x._comp) {}
+
+			//Move assignment operator
+			map& operator=(map&& x)
+			{
+				if (this != &x)
+					this->_tree = std::move(x._tree);
+				return *this;
+			}
+#endif
+
 			// Iterators:
 			iterator begin()
 			{
@@ -184,9 +210,14 @@ namespace ft
 			 * 이렇게 하면 요소에 매핑되니 값이 할당되지 않더라도(기본 생성자를 사용하여 생성됨) 항상 컨테이너 크기가 1씩 증가한다.
 			 * at과 비슷한 역할을 하지만 map::at은 키가 있는 요소가 존재할 때 같은 동작을 하지만 그렇지 않으면 에러를 발생시킨다. -> c++11에서 사용
 			 */
+			//key가 이미 있으면 mapped_type을 만들지 않는다.
+			//없으면 lower_bound 노드를 hint로 주어 다시 탐색하지 않고 그 앞에 삽입한다.
 			mapped_type& operator[](const key_type& k)
 			{
-				return (*(_tree.insert(ft::make_pair(k, mapped_type())).first)).value->second;
+				node_type* node = this->_tree.lower_bound(k);
+				if (node->is_nil || this->_comp(k, node->value.first))
+					node = this->_tree.insert(value_type(k, mapped_type()), node).first;
+				return (node->value.second);
 			}
 
 			/**
@@ -235,6 +266,7 @@ namespace ft
 
 			//2. with hint
 			//position은 hint, 강제가 아니다.
+			//val이 position 바로 앞(또는 바로 뒤)에 들어갈 자리라면 탐색 없이 삽입한다. -> amortized O(1)
 			//insert 성공 - 새로운 element를 가리키는 iterator 반환.
 			//insert 실패 - val과 동일한 Key값 갖고있는 iterator 반환.
 			iterator insert(iterator position, const value_type& val)
@@ -242,16 +274,68 @@ namespace ft
 				return (iterator(this->_tree.insert(val, position.base()).first));
 			}
 
+#ifdef FT_CXX11
+			//val을 노드 안으로 move한다.
+			pair<iterator, bool> insert(value_type&& val)
+			{
+				ft::pair<node_type*, bool> res = this->_tree.insert(std::move(val));
+				return (ft::make_pair(iterator(res.first), res.second));
+			}
+
+			iterator insert(iterator position, value_type&& val)
+			{
+				return (iterator(this->_tree.insert(std::move(val), position.base()).first));
+			}
+
+			//args로 노드 안에 value_type을 바로 만든다. (c++11)
+			//key를 비교하려면 먼저 만들어야 하므로, 이미 있는 key면 만든 원소를 버린다.
+			template <class... Args>
+			pair<iterator, bool> emplace(Args&&... args)
+			{
+				ft::pair<node_type*, bool> res = this->_tree.emplace_hint(NULL, std::forward<Args>(args)...);
+				return (ft::make_pair(iterator(res.first), res.second));
+			}
+
+			template <class... Args>
+			iterator emplace_hint(iterator position, Args&&... args)
+			{
+				return (iterator(this->_tree.emplace_hint(position.base(), std::forward<Args>(args)...).first));
+			}
+
+			//key를 찾은 뒤 없을 때만 args로 mapped_type을 만든다. (c++17)
+			//emplace와 달리 key가 이미 있으면 args를 건드리지 않는다. (move된 인자가 그대로 남는다)
+			//mapped_type은 노드 안에서 args로 바로 생성한다. (ft::emplace_second) -> 임시 객체도 move도 없다.
+			template <class... Args>
+			pair<iterator, bool> try_emplace(const key_type& k, Args&&... args)
+			{
+				node_type* node = this->_tree.lower_bound(k);
+				if (!node->is_nil && !this->_comp(k, node->value.first))
+					return (ft::make_pair(iterator(node), false));
+				node = this->_tree.emplace_hint(node, ft::emplace_second, k, std::forward<Args>(args)...).first;
+				return (ft::make_pair(iterator(node), true));
+			}
+
+			template <class... Args>
+			pair<iterator, bool> try_emplace(Key&& k, Args&&... args)
+			{
+				node_type* node = this->_tree.lower_bound(k);
+				if (!node->is_nil && !this->_comp(k, node->value.first))
+					return (ft::make_pair(iterator(node), false));
+				node = this->_tree.emplace_hint(node, ft::emplace_second, std::move(k), std::forward<Args>(args)...).first;
+				return (ft::make_pair(iterator(node), true));
+			}
+#endif
+
 			//3. range
 			//[first, last) 구간의 element를 insert.
 			//이때, 기존 Key값과 중복되는 element는 추가하지 않는다.
 			//중복되지 않는 element만 추가한다.
+			//비어있는 컨테이너에 정렬된 입력이 들어오면 tree가 O(N)으로 한 번에 만들어진다.
 			template <class InputIterator>
 			void insert(InputIterator first, InputIterator last,
 			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
 			{
-				while (first != last)
-					this->_tree.insert(*first++);
+				this->_tree.insert_range(first, last);
 			}
 
 			/**
@@ -270,7 +354,7 @@ namespace ft
 			//nil노드 erase실행 시 실패.
 			size_type erase(const key_type& k)
 			{
-				return (this->_tree.erase(_tree.find(value_type(k, mapped_type()))));
+				return (this->_tree.erase(_tree.find(k)));
 			}
 
 			void erase(iterator first, iterator last)
@@ -340,12 +424,26 @@ namespace ft
 			 */
 			iterator find(const key_type& k)
 			{
-				return (iterator(this->_tree.find(value_type(k, mapped_type()))));
+				return (iterator(this->_tree.find(k)));
 			}
 
 			const_iterator find(const key_type& k) const
 			{
-				return (const_iterator(this->_tree.find(value_type(k, mapped_type()))));
+				return (const_iterator(this->_tree.find(k)));
+			}
+
+			//Compare가 is_transparent를 정의하면 key_type으로 변환하지 않고 k를 그대로 비교한다.
+			//ex) map<std::string, int, ft::less<void> >::find("key") -> std::string을 만들지 않는다.
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type find(const K& k)
+			{
+				return (iterator(this->_tree.find(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type find(const K& k) const
+			{
+				return (const_iterator(this->_tree.find(k)));
 			}
 
 			/**
@@ -362,7 +460,16 @@ namespace ft
 			 */
 			size_type count(const key_type& k) const
 			{
-				if (this->_tree.find(value_type(k, mapped_type()))->value != NULL)
+				if (!this->_tree.find(k)->is_nil)
+					return (1);
+				else
+					return (0);
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type count(const K& k) const
+			{
+				if (!this->_tree.find(k)->is_nil)
 					return (1);
 				else
 					return (0);
@@ -393,12 +500,24 @@ namespace ft
 			 */
 			iterator lower_bound(const key_type& k)
 			{
-				return (iterator(this->_tree.lower_bound(value_type(k, mapped_type()))));
+				return (iterator(this->_tree.lower_bound(k)));
 			}
 
 			const_iterator lower_bound(const key_type& k) const
 			{
-				return (const_iterator(this->_tree.lower_bound(value_type(k, mapped_type()))));
+				return (const_iterator(this->_tree.lower_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type lower_bound(const K& k)
+			{
+				return (iterator(this->_tree.lower_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type lower_bound(const K& k) const
+			{
+				return (const_iterator(this->_tree.lower_bound(k)));
 			}
 
 			/**
@@ -420,11 +539,23 @@ namespace ft
 			 */
 			iterator upper_bound(const key_type& k)
 			{
-				return (iterator(this->_tree.upper_bound(value_type(k, mapped_type()))));
+				return (iterator(this->_tree.upper_bound(k)));
 			}
 			const_iterator upper_bound(const key_type& k) const
 			{
-				return (const_iterator(this->_tree.upper_bound(value_type(k, mapped_type()))));
+				return (const_iterator(this->_tree.upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type upper_bound(const K& k)
+			{
+				return (iterator(this->_tree.upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type upper_bound(const K& k) const
+			{
+				return (const_iterator(this->_tree.upper_bound(k)));
 			}
 
 			/**
@@ -449,6 +580,39 @@ namespace ft
 				return (ft::make_pair(lower_bound(k), upper_bound(k)));
 			}
 
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<iterator, iterator> >::type equal_range(const K& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<const_iterator, const_iterator> >::type equal_range(const K& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			/**
+			 * @brief select & rank
+			 *
+			 * OrderStatistic = true 로 만든 컨테이너에서만 사용할 수 있다. -> O(logN)
+			 * select(k) : k번째(0부터 시작)로 작은 요소를 가리키는 반복자, k >= size()이면 end()
+			 * rank(k) : 키가 k보다 앞에 오는 요소의 수 (= lower_bound(k)의 위치)
+			 */
+			iterator select(size_type k)
+			{
+				return (iterator(this->_tree.select(k)));
+			}
+			const_iterator select(size_type k) const
+			{
+				return (const_iterator(this->_tree.select(k)));
+			}
+
+			size_type rank(const key_type& k) const
+			{
+				return (this->_tree.rank(k));
+			}
+
 			/**
 			 * @brief Allocator
 			 *
@@ -457,7 +621,7 @@ namespace ft
 			 */
 			allocator_type get_allocator() const
 			{
-				return (this->_alloc);
+				return (this->_tree.get_allocator());
 			}
 
 			void showTree()
@@ -471,45 +635,45 @@ namespace ft
 	/**
 	 * @brief Relational operators
 	 */
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator==(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
+	template <class Key, class T, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator==(const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& lhs, const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator!=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
+	template <class Key, class T, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator!=(const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& lhs, const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (!(lhs == rhs));
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
+	template <class Key, class T, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator<(const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& lhs, const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
+	template <class Key, class T, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator<=(const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& lhs, const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (!(rhs < lhs));
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
+	template <class Key, class T, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator>(const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& lhs, const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (rhs < lhs);
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
+	template <class Key, class T, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator>=(const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& lhs, const map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (!(lhs < rhs));
 	}
 
 	// swap
-	template <class Key, class T, class Compare, class Alloc>
-	void swap(map<Key, T, Compare, Alloc>& x, map<Key, T, Compare, Alloc>& y)
+	template <class Key, class T, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	void swap(map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& x, map<Key, T, Compare, Alloc, OrderStatistic, Threaded>& y)
 	{
 		x.swap(y);
 	}
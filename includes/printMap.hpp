@@ -9,13 +9,25 @@
 #define C_RESET "\e[0m"
 
 namespace ft {
+// map의 value는 pair이므로 key(first)를, set의 value는 key 그대로 출력한다.
 template < typename T >
-void printMap(RBTreeNode< T >* node, int depth) {
+const T& printMapKey(const T& value) {
+  return value;
+}
+
+template < typename K, typename V >
+const K& printMapKey(const pair< K, V >& value) {
+  return value.first;
+}
+
+// order statistic / threaded 노드도 같은 함수로 출력한다.
+template < typename T, bool Counted, bool Threaded >
+void printMap(RBTreeNode< T, Counted, Threaded >* node, int depth) {
   if (depth == 0) {
     std::cout << "// SHOW TREE //" << std::endl;
   }
   int tmp_depth = depth;
-  if (node->value == NULL) {
+  if (node->is_nil) {
     while (tmp_depth--) {
       std::cout << "     ";
     }
@@ -26,13 +38,13 @@ void printMap(RBTreeNode< T >* node, int depth) {
     std::cout << "     ";
   }
   std::cout << (node->color ? C_RESET : C_RED)
-            << (node->parent->value == NULL ? "Root" : (node->parent->leftChild == node ? "L" : "R"))
-            << " - key: " << node->value->first << C_RESET << std::endl;
-  if (node->leftChild->value != NULL) {
+            << (node->parent->is_nil ? "Root" : (node->parent->leftChild == node ? "L" : "R"))
+            << " - key: " << printMapKey(node->value) << C_RESET << std::endl;
+  if (!node->leftChild->is_nil) {
     // std::cout << "left?" << std::endl;
     printMap(node->leftChild, depth + 1);
   }
-  if (node->rightChild->value != NULL) {
+  if (!node->rightChild->is_nil) {
     printMap(node->rightChild, depth + 1);
   }
     // std::cout << "right?" << std::endl;
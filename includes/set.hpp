@@ -21,8 +21,10 @@ namespace ft
 	 * @tparam T	Type of the mapped value.(mapped_type) -> set에서는 사용하지 않는다.
 	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.(key_compare)
 	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 * @tparam OrderStatistic	true이면 select(k)/rank(k)와 O(logN) iterator 거리(ft::distance)를 제공한다. 기본값 false는 추가 비용이 없다.
+	 * @tparam Threaded	true이면 노드가 중위 순회의 prev/next를 가져 iterator의 ++/--가 O(1)이 된다. 기본값 false는 추가 비용이 없다.
 	 */
-	template < class Key, class Compare = ft::less<Key>, class Alloc = std::allocator<Key> >
+	template < class Key, class Compare = ft::less<Key>, class Alloc = std::allocator<Key>, bool OrderStatistic = false, bool Threaded = false >
 	class set {
 		public :
 			/**
@@ -48,14 +50,14 @@ namespace ft
 			typedef typename allocator_type::const_reference	const_reference;
 			typedef typename allocator_type::pointer			pointer;
 			typedef typename allocator_type::const_pointer		const_pointer;
-			typedef typename ft::RBTreeIterator<value_type, value_type*, value_type&>	iterator;
-			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&>	const_iterator;
+			typedef ft::RBTree<value_type, value_compare, allocator_type, OrderStatistic, Threaded>	rb_tree;
+			typedef typename rb_tree::node_type					node_type;
+			typedef typename rb_tree::iterator					iterator;
+			typedef typename rb_tree::const_iterator			const_iterator;
 			typedef ft::reverse_iterator<iterator>				reverse_iterator;
 			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
 			typedef typename allocator_type::difference_type	difference_type;
 			typedef typename allocator_type::size_type			size_type;
-			typedef ft::RBTree<value_type, value_compare>		rb_tree;
-			typedef ft::RBTreeNode<value_type>					node_type;
 
 		/**
 		 * @brief Member variables
@@ -70,7 +72,7 @@ namespace ft
 			 * @brief Member functions
 			 */
 			//Empty constructor
-			explicit set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _tree(), _comp(comp) {}
+			explicit set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _tree(comp, alloc), _comp(comp) {}
 
 			//Range constructor
 			//[first,last) 범위와 동일한 수의 요소로 컨테이너를 구성하고 각 요소는 해당 범위의 해당 요소로 구성한다
@@ -78,17 +80,15 @@ namespace ft
 			set (InputIterator first, InputIterator last,
 					const key_compare& comp = key_compare(),
 					const allocator_type& alloc = allocator_type(),
-					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _alloc(alloc), _tree(), _comp(comp)
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _alloc(alloc), _tree(comp, alloc), _comp(comp)
 			{
 				insert(first, last);
 			}
 
 			//Copy constructor
 			//x에 있는 각 요소의 복사본을 사용하여 컨테이너를 구성한다
-			set (const set& x) : _alloc(x._alloc), _tree(), _comp(x._comp)
-			{
-				*this = x;
-			}
+			//tree의 모양과 색을 그대로 복제한다. -> O(N)
+			set (const set& x) : _alloc(x._alloc), _tree(x._tree), _comp(x._comp) {}
 
 			//Destructor
 			~set() {}
@@ -101,6 +101,20 @@ namespace ft
 				return *this;
 			}
 
+#ifdef FT_CXX11
+			//Move constructor
+			//x의 노드를 그대로 가져온다. -> O(1), x는 빈 set이 된다.
+			set (set&& x) : _alloc(x._alloc), _tree(std::move(x._tree)), _comp(x._comp) {}
+
+			//Move assignment operator
+			set& operator=(set&& x)
+			{
+				if (this != &x)
+					this->_tree = std::move(x._tree);
+				return *this;
+			}
+#endif
+
 			// Iterators:
 			iterator begin()
 			{
@@ -223,16 +237,45 @@ namespace ft
 				return (iterator(this->_tree.insert(val, position.base()).first));
 			}
 
+#ifdef FT_CXX11
+			//val을 노드 안으로 move한다.
+			pair<iterator, bool> insert(value_type&& val)
+			{
+				ft::pair<node_type*, bool> res = this->_tree.insert(std::move(val));
+				return (ft::make_pair(iterator(res.first), res.second));
+			}
+
+			iterator insert(iterator position, value_type&& val)
+			{
+				return (iterator(this->_tree.insert(std::move(val), position.base()).first));
+			}
+
+			//args로 노드 안에 value_type을 바로 만든다. (c++11)
+			//key를 비교하려면 먼저 만들어야 하므로, 이미 있는 key면 만든 원소를 버린다.
+			template <class... Args>
+			pair<iterator, bool> emplace(Args&&... args)
+			{
+				ft::pair<node_type*, bool> res = this->_tree.emplace_hint(NULL, std::forward<Args>(args)...);
+				return (ft::make_pair(iterator(res.first), res.second));
+			}
+
+			template <class... Args>
+			iterator emplace_hint(iterator position, Args&&... args)
+			{
+				return (iterator(this->_tree.emplace_hint(position.base(), std::forward<Args>(args)...).first));
+			}
+#endif
+
 			//3. range
 			//[first, last) 구간의 element를 insert.
 			//이때, 기존 Key값과 중복되는 element는 추가하지 않는다.
 			//중복되지 않는 element만 추가한다.
+			//비어있는 컨테이너에 정렬된 입력이 들어오면 tree가 O(N)으로 한 번에 만들어진다.
 			template <class InputIterator>
 			void insert(InputIterator first, InputIterator last,
 			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
 			{
-				while (first != last)
-					this->_tree.insert(*first++);
+				this->_tree.insert_range(first, last);
 			}
 
 			/**
@@ -251,7 +294,7 @@ namespace ft
 			//nil노드 erase실행 시 실패.
 			size_type erase(const key_type& k)
 			{
-				return (this->_tree.erase(_tree.find(value_type(k))));
+				return (this->_tree.erase(_tree.find(k)));
 			}
 
 			void erase(iterator first, iterator last)
@@ -318,12 +361,26 @@ namespace ft
 			 */
 			iterator find(const key_type& k)
 			{
-				return (iterator(this->_tree.find(value_type(k))));
+				return (iterator(this->_tree.find(k)));
 			}
 
 			const_iterator find(const key_type& k) const
 			{
-				return (const_iterator(this->_tree.find(value_type(k))));
+				return (const_iterator(this->_tree.find(k)));
+			}
+
+			//Compare가 is_transparent를 정의하면 key_type으로 변환하지 않고 k를 그대로 비교한다.
+			//ex) set<std::string, ft::less<void> >::find("key") -> std::string을 만들지 않는다.
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type find(const K& k)
+			{
+				return (iterator(this->_tree.find(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type find(const K& k) const
+			{
+				return (const_iterator(this->_tree.find(k)));
 			}
 
 			/**
@@ -340,7 +397,16 @@ namespace ft
 			 */
 			size_type count(const key_type& k) const
 			{
-				if (this->_tree.find(value_type(k))->value != NULL)
+				if (!this->_tree.find(k)->is_nil)
+					return (1);
+				else
+					return (0);
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type count(const K& k) const
+			{
+				if (!this->_tree.find(k)->is_nil)
 					return (1);
 				else
 					return (0);
@@ -371,12 +437,24 @@ namespace ft
 			 */
 			iterator lower_bound(const key_type& k)
 			{
-				return (iterator(this->_tree.lower_bound(value_type(k))));
+				return (iterator(this->_tree.lower_bound(k)));
 			}
 
 			const_iterator lower_bound(const key_type& k) const
 			{
-				return (const_iterator(this->_tree.lower_bound(value_type(k))));
+				return (const_iterator(this->_tree.lower_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type lower_bound(const K& k)
+			{
+				return (iterator(this->_tree.lower_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type lower_bound(const K& k) const
+			{
+				return (const_iterator(this->_tree.lower_bound(k)));
 			}
 
 			/**
@@ -398,11 +476,23 @@ namespace ft
 			 */
 			iterator upper_bound(const key_type& k)
 			{
-				return (iterator(this->_tree.upper_bound(value_type(k))));
+				return (iterator(this->_tree.upper_bound(k)));
 			}
 			const_iterator upper_bound(const key_type& k) const
 			{
-				return (const_iterator(this->_tree.upper_bound(value_type(k))));
+				return (const_iterator(this->_tree.upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type upper_bound(const K& k)
+			{
+				return (iterator(this->_tree.upper_bound(k)));
+			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type upper_bound(const K& k) const
+			{
+				return (const_iterator(this->_tree.upper_bound(k)));
 			}
 
 			/**
@@ -422,11 +512,38 @@ namespace ft
 			{
 				return (ft::make_pair(lower_bound(k), upper_bound(k)));
 			}
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, pair<iterator, iterator> >::type equal_range(const K& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
 			// pair<const_iterator, const_iterator> equal_range(const key_type& k) const
 			// {
 			// 	return (ft::make_pair(lower_bound(k), upper_bound(k)));
 			// }
 
+			/**
+			 * @brief select & rank
+			 *
+			 * OrderStatistic = true 로 만든 컨테이너에서만 사용할 수 있다. -> O(logN)
+			 * select(k) : k번째(0부터 시작)로 작은 요소를 가리키는 반복자, k >= size()이면 end()
+			 * rank(k) : 키가 k보다 앞에 오는 요소의 수 (= lower_bound(k)의 위치)
+			 */
+			iterator select(size_type k)
+			{
+				return (iterator(this->_tree.select(k)));
+			}
+			const_iterator select(size_type k) const
+			{
+				return (const_iterator(this->_tree.select(k)));
+			}
+
+			size_type rank(const key_type& k) const
+			{
+				return (this->_tree.rank(k));
+			}
+
 			/**
 			 * @brief Allocator
 			 *
@@ -435,7 +552,7 @@ namespace ft
 			 */
 			allocator_type get_allocator() const
 			{
-				return (this->_alloc);
+				return (this->_tree.get_allocator());
 			}
 
 			void showTree()
@@ -449,45 +566,45 @@ namespace ft
 	/**
 	 * @brief Relational operators
 	 */
-	template <class Key, class Compare, class Alloc>
-	bool operator==(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs)
+	template <class Key, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator==(const set<Key, Compare, Alloc, OrderStatistic, Threaded>& lhs, const set<Key, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 	}
 
-	template <class Key, class Compare, class Alloc>
-	bool operator!=(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs)
+	template <class Key, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator!=(const set<Key, Compare, Alloc, OrderStatistic, Threaded>& lhs, const set<Key, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (!(lhs == rhs));
 	}
 
-	template <class Key, class Compare, class Alloc>
-	bool operator<(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs)
+	template <class Key, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator<(const set<Key, Compare, Alloc, OrderStatistic, Threaded>& lhs, const set<Key, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 	}
 
-	template <class Key, class Compare, class Alloc>
-	bool operator<=(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs)
+	template <class Key, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator<=(const set<Key, Compare, Alloc, OrderStatistic, Threaded>& lhs, const set<Key, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (!(rhs < lhs));
 	}
 
-	template <class Key, class Compare, class Alloc>
-	bool operator>(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs)
+	template <class Key, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator>(const set<Key, Compare, Alloc, OrderStatistic, Threaded>& lhs, const set<Key, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (rhs < lhs);
 	}
 
-	template <class Key, class Compare, class Alloc>
-	bool operator>=(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs)
+	template <class Key, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	bool operator>=(const set<Key, Compare, Alloc, OrderStatistic, Threaded>& lhs, const set<Key, Compare, Alloc, OrderStatistic, Threaded>& rhs)
 	{
 		return (!(lhs < rhs));
 	}
 
 	// swap
-	template <class Key, class Compare, class Alloc>
-	void swap(set<Key, Compare, Alloc>& x, set<Key, Compare, Alloc>& y)
+	template <class Key, class Compare, class Alloc, bool OrderStatistic, bool Threaded>
+	void swap(set<Key, Compare, Alloc, OrderStatistic, Threaded>& x, set<Key, Compare, Alloc, OrderStatistic, Threaded>& y)
 	{
 		x.swap(y);
 	}
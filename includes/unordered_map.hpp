@@ -0,0 +1,371 @@
+#ifndef UNORDERED_MAP_HPP
+# define UNORDERED_MAP_HPP
+
+#include <stdexcept>
+#include "hash.hpp"
+#include "HashTable.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief unordered_map class
+	 *
+	 * key 순서가 필요 없는 map. (c++11 std::unordered_map)
+	 * RBTree 대신 open addressing HashTable에 원소를 저장한다. (HashTable 참고)
+	 * -> 탐색이 평균 O(1)이고, 노드 할당 없이 slot 배열 하나에 원소를 저장한다.
+	 *
+	 * std::unordered_map과 다른 점
+	 * - bucket이 없으므로 bucket interface(bucket, bucket_size, local_iterator)는 없다. bucket_count는 slot 수이다.
+	 * - max_load_factor는 1보다 클 수 없다.
+	 * - rehash가 일어나면 원소가 이동하므로 모든 iterator와 원소의 주소가 무효화된다.
+	 *
+	 * @tparam Key	Type of the keys.(key_type)
+	 * @tparam T	Type of the mapped value.(mapped_type)
+	 * @tparam Hash	key를 받아 size_t를 반환하는 함수 객체.(hasher)
+	 * @tparam Pred	두 key가 같은지 반환하는 함수 객체.(key_equal)
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 */
+	template < class Key, class T, class Hash = ft::hash<Key>, class Pred = ft::equal_to<Key>,
+		class Alloc = std::allocator< ft::pair<const Key, T> > >
+	class unordered_map {
+		public :
+			/**
+			 * @brief Member types
+			 */
+			typedef const Key	key_type;
+			typedef T	mapped_type;
+			typedef ft::pair<key_type, mapped_type>	value_type;
+			typedef Hash	hasher;
+			typedef Pred	key_equal;
+
+			//원소(value_type)와 key 모두 key로 hash한다.
+			class value_hash
+			{
+				friend class unordered_map;
+				protected:
+					Hash hash;
+					value_hash(Hash h) : hash(h) {}
+				public:
+					value_hash() : hash() {}
+					size_t operator()(const value_type& v) const
+					{
+						return (hash(v.first));
+					}
+					size_t operator()(const key_type& k) const
+					{
+						return (hash(k));
+					}
+			};
+
+			//원소의 key와 (원소 또는) key를 비교한다.
+			class value_equal
+			{
+				friend class unordered_map;
+				protected:
+					Pred eq;
+					value_equal(Pred p) : eq(p) {}
+				public:
+					value_equal() : eq() {}
+					bool operator()(const value_type& lhs, const value_type& rhs) const
+					{
+						return (eq(lhs.first, rhs.first));
+					}
+					bool operator()(const value_type& lhs, const key_type& k) const
+					{
+						return (eq(lhs.first, k));
+					}
+			};
+			typedef Alloc	allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef ft::HashTable<value_type, value_hash, value_equal, allocator_type>	hash_table;
+			typedef typename hash_table::iterator					iterator;
+			typedef typename hash_table::const_iterator				const_iterator;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef typename allocator_type::size_type			size_type;
+
+		/**
+		 * @brief Member variables
+		 */
+		private:
+			hash_table		_table;
+			hasher			_hash;
+			key_equal		_eq;
+
+		public:
+			/**
+			 * @brief Member functions
+			 */
+			//Empty constructor
+			//n: 처음에 rehash 없이 넣을 수 있는 원소 수
+			explicit unordered_map (size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+					const allocator_type& alloc = allocator_type()) : _table(value_hash(hf), value_equal(eql), alloc), _hash(hf), _eq(eql)
+			{
+				this->_table.reserve(n);
+			}
+
+			//Range constructor
+			template <class InputIterator>
+			unordered_map (InputIterator first, InputIterator last, size_type n = 0,
+					const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+					const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+					: _table(value_hash(hf), value_equal(eql), alloc), _hash(hf), _eq(eql)
+			{
+				this->_table.reserve(n);
+				insert(first, last);
+			}
+
+			//Copy constructor
+			unordered_map (const unordered_map& x) : _table(x._table), _hash(x._hash), _eq(x._eq) {}
+
+			//Destructor
+			~unordered_map() {}
+
+			//Assignment operator
+			unordered_map& operator=(const unordered_map& x)
+			{
+				if (this != &x)
+				{
+					this->_table = x._table;
+					this->_hash = x._hash;
+					this->_eq = x._eq;
+				}
+				return *this;
+			}
+
+			// Iterators:
+			iterator begin()
+			{
+				return (this->_table.begin());
+			}
+			const_iterator begin() const
+			{
+				return (this->_table.begin());
+			}
+
+			iterator end()
+			{
+				return (this->_table.end());
+			}
+			const_iterator end() const
+			{
+				return (this->_table.end());
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_table.empty());
+			}
+			size_type size() const
+			{
+				return (this->_table.size());
+			}
+			size_type max_size() const
+			{
+				return (this->_table.max_size());
+			}
+
+			//Element access
+			//key가 이미 있으면 mapped_type을 만들지 않는다.
+			mapped_type& operator[](const key_type& k)
+			{
+				iterator it = find(k);
+				if (it == end())
+					it = this->_table.insert(value_type(k, mapped_type())).first;
+				return (it->second);
+			}
+
+			mapped_type& at(const key_type& k)
+			{
+				iterator it = find(k);
+				if (it == end())
+					throw std::out_of_range("unordered_map::at");
+				return (it->second);
+			}
+
+			const mapped_type& at(const key_type& k) const
+			{
+				const_iterator it = find(k);
+				if (it == end())
+					throw std::out_of_range("unordered_map::at");
+				return (it->second);
+			}
+
+			//Modifiers
+			pair<iterator, bool> insert(const value_type& val)
+			{
+				return (this->_table.insert(val));
+			}
+
+			//순서가 없으므로 hint는 사용하지 않는다.
+			iterator insert(iterator position, const value_type& val)
+			{
+				(void)position;
+				return (this->_table.insert(val).first);
+			}
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last,
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				for (; first != last; ++first)
+					this->_table.insert(*first);
+			}
+
+			//원소를 옮기지 않으므로 다른 iterator는 유효하다. -> erase(it++) 가능
+			void erase(iterator position)
+			{
+				this->_table.erase(position);
+			}
+
+			size_type erase(const key_type& k)
+			{
+				return (this->_table.erase_key(k));
+			}
+
+			void erase(iterator first, iterator last)
+			{
+				while (first != last)
+					this->_table.erase(first++);
+			}
+
+			void swap(unordered_map& x)
+			{
+				hasher tmp_hash = this->_hash;
+				key_equal tmp_eq = this->_eq;
+				this->_table.swap(x._table);
+				this->_hash = x._hash;
+				this->_eq = x._eq;
+				x._hash = tmp_hash;
+				x._eq = tmp_eq;
+			}
+
+			//원소만 지우고 slot 배열은 유지한다.
+			void clear()
+			{
+				this->_table.clear();
+			}
+
+			//Observers
+			hasher hash_function() const
+			{
+				return (this->_hash);
+			}
+
+			key_equal key_eq() const
+			{
+				return (this->_eq);
+			}
+
+			//Operations
+			iterator find(const key_type& k)
+			{
+				return (this->_table.find(k));
+			}
+
+			const_iterator find(const key_type& k) const
+			{
+				return (this->_table.find(k));
+			}
+
+			size_type count(const key_type& k) const
+			{
+				return (find(k) != end() ? 1 : 0);
+			}
+
+			pair<iterator, iterator> equal_range(const key_type& k)
+			{
+				iterator it = find(k);
+				if (it == end())
+					return (ft::make_pair(it, it));
+				iterator next = it;
+				return (ft::make_pair(it, ++next));
+			}
+
+			pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+			{
+				const_iterator it = find(k);
+				if (it == end())
+					return (ft::make_pair(it, it));
+				const_iterator next = it;
+				return (ft::make_pair(it, ++next));
+			}
+
+			//Hash policy
+			//bucket_count는 slot 수이다.
+			size_type bucket_count() const
+			{
+				return (this->_table.capacity());
+			}
+
+			float load_factor() const
+			{
+				return (this->_table.load_factor());
+			}
+
+			float max_load_factor() const
+			{
+				return (this->_table.max_load_factor());
+			}
+
+			void max_load_factor(float ml)
+			{
+				this->_table.max_load_factor(ml);
+			}
+
+			//slot 수를 n 이상으로 다시 만든다.
+			void rehash(size_type n)
+			{
+				this->_table.rehash(n);
+			}
+
+			//원소 n개를 rehash 없이 넣을 수 있도록 한다.
+			void reserve(size_type n)
+			{
+				this->_table.reserve(n);
+			}
+
+			//Allocator
+			allocator_type get_allocator() const
+			{
+				return (this->_table.get_allocator());
+			}
+	};
+
+	/**
+	 * @brief Relational operators
+	 * 순서가 없으므로 lhs의 모든 원소가 rhs에 같은 값으로 있는지 확인한다.
+	 */
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	bool operator==(const unordered_map<Key, T, Hash, Pred, Alloc>& lhs, const unordered_map<Key, T, Hash, Pred, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		for (typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+		{
+			typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator found = rhs.find(it->first);
+			if (found == rhs.end() || !(found->second == it->second))
+				return (false);
+		}
+		return (true);
+	}
+
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	bool operator!=(const unordered_map<Key, T, Hash, Pred, Alloc>& lhs, const unordered_map<Key, T, Hash, Pred, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	// swap
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	void swap(unordered_map<Key, T, Hash, Pred, Alloc>& x, unordered_map<Key, T, Hash, Pred, Alloc>& y)
+	{
+		x.swap(y);
+	}
+} // namespace ft
+
+#endif
@@ -3,13 +3,35 @@
 
 #include "iterator.hpp"
 
+/**
+ * c++11 build
+ * 기본은 c++98이고, c++11 이상으로 compile하면 FT_CXX11이 정의된다. (make CXXSTD=c++11)
+ * FT_CXX11에서만 move constructor/assignment, emplace, try_emplace를 제공한다.
+ * FT_MOVE(x)는 c++11에서는 std::move(x), c++98에서는 x 그대로 (복사)
+ * FT_FORWARD(T, x)는 c++11에서는 std::forward<T>(x), c++98에서는 x 그대로 (template <class T> f(T&& x)의 c++98판은 const value_type& x)
+ */
+#if __cplusplus >= 201103L
+# define FT_CXX11
+# include <utility>
+# define FT_MOVE(x) std::move(x)
+# define FT_FORWARD(T, x) std::forward<T>(x)
+#else
+# define FT_MOVE(x) (x)
+# define FT_FORWARD(T, x) (x)
+#endif
+
 /**
  * utils implement
+ * distance/advance
  * enable_if
  * is_integral
+ * is_trivially_destructible
+ * is_trivially_relocatable
+ * is_trivially_default_constructible
  * equal/lexicographical compare
  * std::pair
  * std::make_pair
+ * c++11: FT_CXX11, FT_MOVE, FT_FORWARD
  */
 
 namespace ft
@@ -22,20 +44,77 @@ namespace ft
 	 * @brief distance
 	 * User-defined function for finding the distance between two iterators.
 	 * implementation via tag dispatch, available in C++98 with constexpr removed
+	 * random access iterator는 last - first로 O(1), 나머지는 하나씩 세어 O(N)
+	 * (input iterator는 세는 동안 범위를 소비하므로, 범위를 다시 읽어야 하는 곳에서는 쓰면 안 된다.)
 	 * @tparam InputIterator		iterator type
 	 * @param first		initial position of the iterator
 	 * @param last		final position of the iterator
 	 * @return iterator_traits<InputIterator>::difference_type	distance between two iterators
 	 */
 	template <typename InputIterator>
-	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last)
+	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last, ft::input_iterator_tag)
 	{
 		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
-		while (first++ != last)
-			n++;
+		while (first != last)
+		{
+			++first;
+			++n;
+		}
 		return (n);
 	}
 
+	template <typename RandomAccessIterator>
+	typename ft::iterator_traits<RandomAccessIterator>::difference_type distance(RandomAccessIterator first, RandomAccessIterator last, ft::random_access_iterator_tag)
+	{
+		return (last - first);
+	}
+
+	template <typename InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last)
+	{
+		return (ft::distance(first, last, ft::iterator_category(first)));
+	}
+
+	/**
+	 * @brief advance
+	 * iterator를 n만큼 이동한다. random access iterator는 it += n으로 O(1)
+	 * 음수 n은 bidirectional 이상에서만 가능하다.
+	 */
+	template <typename InputIterator>
+	void advance(InputIterator& it, typename ft::iterator_traits<InputIterator>::difference_type n, ft::input_iterator_tag)
+	{
+		while (n-- > 0)
+			++it;
+	}
+
+	template <typename BidirectionalIterator>
+	void advance(BidirectionalIterator& it, typename ft::iterator_traits<BidirectionalIterator>::difference_type n, ft::bidirectional_iterator_tag)
+	{
+		while (n > 0)
+		{
+			++it;
+			--n;
+		}
+		while (n < 0)
+		{
+			--it;
+			++n;
+		}
+	}
+
+	template <typename RandomAccessIterator>
+	void advance(RandomAccessIterator& it, typename ft::iterator_traits<RandomAccessIterator>::difference_type n, ft::random_access_iterator_tag)
+	{
+		it += n;
+	}
+
+	template <typename InputIterator, typename Distance>
+	void advance(InputIterator& it, Distance n)
+	{
+		typename ft::iterator_traits<InputIterator>::difference_type d = n;
+		ft::advance(it, d, ft::iterator_category(it));
+	}
+
 	/**
 	 * enable_if
 	 *
@@ -130,6 +209,58 @@ namespace ft
 	template <typename T>
 	struct is_integral : public is_integral_type<T> {};
 
+	/**
+	 * is_trivially_destructible
+	 *
+	 * T의 소멸자가 아무 일도 하지 않아 호출을 생략해도 되는지 확인한다.
+	 * c++98에는 type traits가 없으므로 컴파일러 내장 함수를 사용하고,
+	 * 지원하지 않는 컴파일러에서는 integral type만 true로 취급한다.
+	 */
+#if defined(__clang__)
+	template <typename T>
+	struct is_trivially_destructible : public integral_traits<__is_trivially_destructible(T), bool> {};
+#elif defined(__GNUC__)
+	template <typename T>
+	struct is_trivially_destructible : public integral_traits<__has_trivial_destructor(T), bool> {};
+#else
+	template <typename T>
+	struct is_trivially_destructible : public integral_traits<is_integral<T>::value, bool> {};
+#endif
+
+	/**
+	 * is_trivially_relocatable
+	 *
+	 * T를 복사 생성한 뒤 원래 원소를 소멸시키는 것이 바이트 복사(memcpy/memmove)와 같은지 확인한다.
+	 * 복사 생성자와 소멸자가 모두 trivial하면 true이다. (int, 포인터, POD struct, ft::pair<int, int> 등)
+	 */
+#if defined(__clang__)
+	template <typename T>
+	struct is_trivially_relocatable : public integral_traits<__is_trivially_copyable(T), bool> {};
+#elif defined(__GNUC__)
+	template <typename T>
+	struct is_trivially_relocatable : public integral_traits<__has_trivial_copy(T) && __has_trivial_destructor(T), bool> {};
+#else
+	template <typename T>
+	struct is_trivially_relocatable : public integral_traits<is_integral<T>::value, bool> {};
+#endif
+
+	/**
+	 * is_trivially_default_constructible
+	 *
+	 * T의 기본 생성자가 아무 일도 하지 않는지 확인한다. (int, char, 포인터, POD struct 등)
+	 * true이면 default-initialization(new (p) T)은 메모리에 아무것도 쓰지 않는다.
+	 */
+#if defined(__clang__)
+	template <typename T>
+	struct is_trivially_default_constructible : public integral_traits<__is_trivially_constructible(T), bool> {};
+#elif defined(__GNUC__)
+	template <typename T>
+	struct is_trivially_default_constructible : public integral_traits<__has_trivial_constructor(T), bool> {};
+#else
+	template <typename T>
+	struct is_trivially_default_constructible : public integral_traits<is_integral<T>::value, bool> {};
+#endif
+
 	//equality
 	template <class InputIterator1, class InputIterator2>
 	bool equal (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
@@ -213,6 +344,17 @@ namespace ft
 		return (first2 != last2);
 	};
 
+#ifdef FT_CXX11
+	/**
+	 * @brief emplace_second
+	 * pair(emplace_second, a, args...)는 first를 a로, second를 args...로 그 자리에서 바로 생성한다.
+	 * std::piecewise_construct와 같은 용도지만 tuple 대신 first의 인자 하나 뒤에 second의 인자를 그대로 붙여 넘긴다.
+	 * -> map::try_emplace가 mapped_type의 임시 객체 없이 노드 안에 직접 생성한다. (move할 수 없는 타입도 된다)
+	 */
+	struct emplace_second_t {};
+	static const emplace_second_t emplace_second = emplace_second_t();
+#endif
+
 	/**
 	 * @brief pair
 	 * 두 객체를 하나의 객체로 취급 할 수 있게 묶어주는 클래스
@@ -236,16 +378,15 @@ namespace ft
 			template<class U, class V> pair (const pair<U, V>& pr) : first(pr.first), second(pr.second) {}
 			//initialization
 			pair(const first_type& a, const second_type& b) : first(a), second(b) {}
-			//assign
-			pair& operator= (const pair& pr)
-			{
-				if (this != &pr)
-				{
-					this->first = pr.first;
-					this->second = pr.second;
-				}
-				return (*this);
-			}
+#ifdef FT_CXX11
+			//인자를 그대로 first/second의 생성자에 넘긴다. -> 임시 객체를 복사하지 않고 move한다.
+			template<class U, class V> pair (U&& a, V&& b) : first(std::forward<U>(a)), second(std::forward<V>(b)) {}
+			template<class U, class V> pair (pair<U, V>&& pr) : first(std::forward<U>(pr.first)), second(std::forward<V>(pr.second)) {}
+			//second는 args...로 직접 초기화한다. -> 인자가 하나여도 C-style cast가 아니라 second의 생성자를 호출한다.
+			template<class U, class... Args> pair (emplace_second_t, U&& a, Args&&... args) : first(std::forward<U>(a)), second(std::forward<Args>(args)...) {}
+#endif
+			//copy/assign은 컴파일러가 만든 것을 사용한다.
+			//-> first/second가 trivial하면 pair도 trivially copyable이고, c++11에서는 move도 자동으로 생긴다.
 	};
 
 	/**
@@ -261,7 +402,7 @@ namespace ft
 	template <class T1, class T2>
 	pair<T1, T2> make_pair(T1 x, T2 y)
 	{
-		return (pair<T1, T2>(x,y));
+		return (pair<T1, T2>(FT_MOVE(x), FT_MOVE(y)));
 	};
 
 	template <class T1, class T2>
@@ -343,6 +484,51 @@ namespace ft
 			return (x < y);
 		}
 	};
+
+	/**
+	 * @brief less<void>
+	 * 인수 타입을 고정하지 않고 operator<를 그대로 적용하는 비교 객체. (c++14 std::less<void>)
+	 * is_transparent를 정의하므로 map/set의 find/count/lower_bound/upper_bound/equal_range에
+	 * key_type이 아닌 타입을 그대로 넘길 수 있다.
+	 * ex) ft::map<std::string, int, ft::less<void> >에서 find("key") -> std::string을 만들지 않는다.
+	 */
+	template <>
+	struct less<void>
+	{
+		typedef void	is_transparent;
+
+		template <class T, class U>
+		bool operator()(const T& x, const U& y) const
+		{
+			return (x < y);
+		}
+	};
+
+	/**
+	 * @brief is_transparent
+	 * Compare가 is_transparent 타입을 정의하는지 확인한다.
+	 * 정의한 경우에만 map/set의 heterogeneous lookup이 overload 후보가 된다.
+	 */
+	template <class Compare>
+	struct is_transparent
+	{
+		private:
+			typedef char	yes;
+			struct no { char c[2]; };
+
+			template <class C>
+			static yes test(typename C::is_transparent*);
+			template <class C>
+			static no test(...);
+
+		public:
+			static const bool value = (sizeof(test<Compare>(0)) == sizeof(yes));
+	};
+
+	//Compare가 transparent일 때만 R을 type으로 가진다.
+	//K는 사용하지 않지만, member template의 반환 타입이 K에 의존하도록 만들어 SFINAE가 적용되게 한다.
+	template <class Compare, class K, class R>
+	struct enable_if_transparent : public enable_if<is_transparent<Compare>::value, R> {};
 }
 
 #endif
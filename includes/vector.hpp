@@ -4,9 +4,44 @@
 // #include <vector>
 #include <memory>
 #include <stdexcept>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <new>
 #include "VectorIterator.hpp"
 #include "utils.hpp"
 
+/**
+ * @brief growth factor
+ * capacity가 부족할 때 새 capacity = max(size * NUM / DEN, 필요한 크기)
+ * push_back뿐 아니라 insert(fill/range), resize도 같은 비율로 늘어나므로 반복 삽입의 재할당은 O(logN)번이다.
+ * 기본값은 2배. compile 시 -DFT_VECTOR_GROWTH_NUM=3 -DFT_VECTOR_GROWTH_DEN=2 로 1.5배로 바꿀 수 있다.
+ */
+#ifndef FT_VECTOR_GROWTH_NUM
+# define FT_VECTOR_GROWTH_NUM 2
+#endif
+#ifndef FT_VECTOR_GROWTH_DEN
+# define FT_VECTOR_GROWTH_DEN 1
+#endif
+
+/**
+ * @brief realloc threshold
+ * ft::realloc_allocator를 쓰는 vector는 저장공간이 이 크기(바이트) 이상이면 realloc으로 늘린다.
+ * 그보다 작은 buffer는 기존처럼 새로 할당해서 옮긴다. 기본값 1MB
+ */
+#ifndef FT_VECTOR_REALLOC_THRESHOLD
+# define FT_VECTOR_REALLOC_THRESHOLD (1 << 20)
+#endif
+
+/**
+ * @brief fill block
+ * 같은 값으로 여러 원소를 채울 때 이 크기(바이트)의 block을 먼저 만들고 memcpy로 반복해서 복사한다.
+ * block이 L1 cache에 남아 있으므로 쓰기 대역폭만 쓴다.
+ */
+#ifndef FT_VECTOR_FILL_BLOCK
+# define FT_VECTOR_FILL_BLOCK 4096
+#endif
+
 /**
  * @brief vector
  *
@@ -115,6 +150,142 @@
  */
 namespace ft
 {
+	/**
+	 * @brief is_memmove_relocatable
+	 * std::allocator의 construct/destroy는 복사 생성자/소멸자만 호출하므로,
+	 * T가 trivially relocatable이면 원소를 옮길 때 construct + destroy 대신 memmove를 사용할 수 있다.
+	 * 다른 allocator는 construct/destroy가 무슨 일을 할지 모르므로 원소 단위로 옮긴다.
+	 */
+	template < typename T, typename Alloc >
+	struct is_memmove_relocatable : public integral_traits<false, bool> {};
+
+	template < typename T >
+	struct is_memmove_relocatable< T, std::allocator<T> > : public integral_traits<ft::is_trivially_relocatable<T>::value, bool> {};
+
+	/**
+	 * @brief realloc_allocator
+	 * malloc/free로 할당하고, 저장공간을 늘리는 reallocate(realloc)를 추가로 제공하는 allocator.
+	 * std::allocator(operator new)로 받은 메모리는 realloc할 수 없으므로 따로 둔다.
+	 * glibc의 realloc은 뒤가 비어 있으면 제자리에서 늘리고, mmap으로 받은 큰 block은 mremap으로 page를 다시 붙인다.
+	 * -> 수 GB까지 커지는 vector도 원소를 복사하지 않고, 옛 buffer와 새 buffer가 동시에 존재하지 않는다.
+	 * ex) ft::vector<int, ft::realloc_allocator<int> >
+	 */
+	template <typename T>
+	class realloc_allocator
+	{
+		public:
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef std::size_t		size_type;
+			typedef std::ptrdiff_t	difference_type;
+
+			template <typename U>
+			struct rebind
+			{
+				typedef realloc_allocator<U> other;
+			};
+
+			realloc_allocator() throw() {}
+			template <typename U>
+			realloc_allocator(const realloc_allocator<U>&) throw() {}
+
+			pointer address(reference x) const
+			{
+				return (&x);
+			}
+
+			const_pointer address(const_reference x) const
+			{
+				return (&x);
+			}
+
+			pointer allocate(size_type n, const void* = 0)
+			{
+				if (n > this->max_size())
+					throw(std::bad_alloc());
+				void* p = std::malloc(n * sizeof(T));
+				if (p == NULL && n != 0)
+					throw(std::bad_alloc());
+				return (static_cast<pointer>(p));
+			}
+
+			void deallocate(pointer p, size_type)
+			{
+				std::free(p);
+			}
+
+			//p의 저장공간을 n개 크기로 바꾼다. 실패하면 p는 그대로 남는다.
+			//원소를 바이트 단위로 옮기므로 trivially relocatable 원소에만 사용한다.
+			pointer reallocate(pointer p, size_type, size_type n)
+			{
+				if (n > this->max_size())
+					throw(std::bad_alloc());
+				void* res = std::realloc(p, n * sizeof(T));
+				if (res == NULL && n != 0)
+					throw(std::bad_alloc());
+				return (static_cast<pointer>(res));
+			}
+
+			size_type max_size() const throw()
+			{
+				return (static_cast<size_type>(-1) / sizeof(T));
+			}
+
+#ifdef FT_CXX11
+			template <typename U, typename... Args>
+			void construct(U* p, Args&&... args)
+			{
+				::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+			}
+#else
+			void construct(pointer p, const_reference val)
+			{
+				::new(static_cast<void*>(p)) T(val);
+			}
+#endif
+
+			void destroy(pointer p)
+			{
+				p->~T();
+			}
+	};
+
+	template <typename T, typename U>
+	bool operator==(const realloc_allocator<T>&, const realloc_allocator<U>&)
+	{
+		return (true);
+	}
+
+	template <typename T, typename U>
+	bool operator!=(const realloc_allocator<T>&, const realloc_allocator<U>&)
+	{
+		return (false);
+	}
+
+	//realloc_allocator의 construct/destroy도 복사 생성자/소멸자만 호출한다.
+	template < typename T >
+	struct is_memmove_relocatable< T, realloc_allocator<T> > : public integral_traits<ft::is_trivially_relocatable<T>::value, bool> {};
+
+	//저장공간을 allocator의 reallocate로 늘릴 수 있는지 판별한다.
+	template < typename T, typename Alloc >
+	struct is_reallocatable : public integral_traits<false, bool> {};
+
+	template < typename T >
+	struct is_reallocatable< T, realloc_allocator<T> > : public integral_traits<ft::is_trivially_relocatable<T>::value, bool> {};
+
+	//allocator의 destroy가 소멸자만 호출하고 소멸자가 아무 일도 하지 않으면 원소를 하나씩 소멸시키지 않아도 된다.
+	template < typename T, typename Alloc >
+	struct is_trivially_destroyable : public integral_traits<false, bool> {};
+
+	template < typename T >
+	struct is_trivially_destroyable< T, std::allocator<T> > : public integral_traits<ft::is_trivially_destructible<T>::value, bool> {};
+
+	template < typename T >
+	struct is_trivially_destroyable< T, realloc_allocator<T> > : public integral_traits<ft::is_trivially_destructible<T>::value, bool> {};
+
 	template < typename T, typename Allocator = std::allocator<T> >
 	class vector
 	{
@@ -156,6 +327,297 @@ namespace ft
 			pointer			_end;
 			pointer			_end_of_capacity;
 
+			//원소 new_size개가 들어갈 새 capacity. 현재 크기에 growth factor를 곱한 값보다 작아지지 않는다.
+			size_type recommend(size_type new_size) const
+			{
+				size_type ms = this->max_size();
+				if (new_size > ms)
+					throw(std::length_error("Error: ft::vector::insert"));
+				size_type cur = this->size();
+				if (cur >= ms / FT_VECTOR_GROWTH_NUM * FT_VECTOR_GROWTH_DEN)
+					return (ms);
+				size_type grow = cur * FT_VECTOR_GROWTH_NUM / FT_VECTOR_GROWTH_DEN;
+				if (grow < new_size)
+					grow = new_size;
+				return (grow);
+			}
+
+			/**
+			 * @brief relocate
+			 * [first, last)의 원소를 dst로 옮기고(c++11에서는 move) 원래 자리의 원소는 소멸시킨다.
+			 * 앞에서부터 옮기므로 겹치는 구간이면 dst <= first여야 한다. (erase)
+			 */
+			void relocate(pointer dst, pointer first, pointer last)
+			{
+				if (ft::is_memmove_relocatable<value_type, allocator_type>::value)
+				{
+					if (first != last)
+						std::memmove(static_cast<void*>(dst), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+					return ;
+				}
+				while (first != last)
+				{
+					this->_alloc.construct(dst++, FT_MOVE(*first));
+					this->_alloc.destroy(first++);
+				}
+			}
+
+			/**
+			 * @brief construct_fill
+			 * 초기화되지 않은 [dst, dst + n)에 val의 복사본을 만든다.
+			 * memmove로 옮길 수 있는 원소(trivially copyable)는 복사 생성이 바이트 복사와 같으므로
+			 * - val의 바이트가 모두 같으면 (0, -1, char 등) memset
+			 * - 아니면 FT_VECTOR_FILL_BLOCK 크기의 block을 만들어 memcpy로 반복한다.
+			 * 나머지는 원소마다 construct
+			 */
+			void construct_fill(pointer dst, size_type n, const value_type &val)
+			{
+				if (n == 0)
+					return ;
+				if (!ft::is_memmove_relocatable<value_type, allocator_type>::value)
+				{
+					while (n--)
+						this->_alloc.construct(dst++, val);
+					return ;
+				}
+				const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&val);
+				size_type i = 1;
+				while (i < sizeof(value_type) && bytes[i] == bytes[0])
+					++i;
+				if (i == sizeof(value_type))
+				{
+					std::memset(static_cast<void*>(dst), bytes[0], n * sizeof(value_type));
+					return ;
+				}
+				std::memcpy(static_cast<void*>(dst), static_cast<const void*>(&val), sizeof(value_type));
+				//앞의 block을 두 배씩 키운 뒤, 그 block을 반복해서 복사한다.
+				size_type block = std::min(n, std::max(static_cast<size_type>(FT_VECTOR_FILL_BLOCK / sizeof(value_type)), static_cast<size_type>(1)));
+				size_type done = 1;
+				while (done < block)
+				{
+					size_type k = std::min(done, block - done);
+					std::memcpy(static_cast<void*>(dst + done), static_cast<const void*>(dst), k * sizeof(value_type));
+					done += k;
+				}
+				while (done < n)
+				{
+					size_type k = std::min(block, n - done);
+					std::memcpy(static_cast<void*>(dst + done), static_cast<const void*>(dst), k * sizeof(value_type));
+					done += k;
+				}
+			}
+
+			//[first, last)의 원소를 소멸시킨다. 소멸자가 아무 일도 하지 않으면 생략한다.
+			void destroy_range(pointer first, pointer last)
+			{
+				if (ft::is_trivially_destroyable<value_type, allocator_type>::value)
+					return ;
+				while (first != last)
+					this->_alloc.destroy(first++);
+			}
+
+			//[position, _end)를 n칸 뒤로 옮긴다. (memmove로 옮길 수 있는 경우만)
+			void shift_back(pointer position, size_type n)
+			{
+				std::memmove(static_cast<void*>(position + n), static_cast<const void*>(position), (this->_end - position) * sizeof(value_type));
+				this->_end += n;
+			}
+
+			//저장공간을 n개로 바꾼다. 새로 할당한 뒤 원소를 옮긴다.
+			void reallocate_storage(size_type n, integral_traits<false, bool>)
+			{
+				pointer prev_start = this->_start;
+				pointer prev_end = this->_end;
+				pointer prev_end_of_capacity = this->_end_of_capacity;
+
+				this->_start = this->_alloc.allocate(n);
+				this->_end = this->_start + (prev_end - prev_start);
+				this->_end_of_capacity = this->_start + n;
+				this->relocate(this->_start, prev_start, prev_end);
+				this->_alloc.deallocate(prev_start, prev_end_of_capacity - prev_start);
+			}
+
+			//realloc_allocator: 큰 buffer는 allocator의 reallocate(realloc/mremap)로 늘린다.
+			void reallocate_storage(size_type n, integral_traits<true, bool>)
+			{
+				if (this->capacity() * sizeof(value_type) < FT_VECTOR_REALLOC_THRESHOLD)
+					return (this->reallocate_storage(n, integral_traits<false, bool>()));
+				size_type count = this->size();
+				this->_start = this->_alloc.reallocate(this->_start, this->capacity(), n);
+				this->_end = this->_start + count;
+				this->_end_of_capacity = this->_start + n;
+			}
+
+			//맨 뒤에 붙이다 저장공간이 부족하면 reserve로 늘린다. -> realloc을 쓸 수 있다.
+			//중간 삽입은 새 저장공간에 원소를 나눠 옮겨야 하므로 해당하지 않는다.
+			bool grows_in_place(pointer position) const
+			{
+				return (ft::is_reallocatable<value_type, allocator_type>::value && position == this->_end);
+			}
+
+			/**
+			 * @brief range_init, range_assign, range_insert
+			 * range constructor/assign/insert를 iterator category로 나눈다.
+			 * forward 이상	- 원소 수를 먼저 구해 한 번에 할당한다. (random access는 ft::distance가 O(1))
+			 * input		- 범위를 한 번만 읽을 수 있으므로 원소 수를 모른 채 하나씩 붙인다. (istream_iterator 등)
+			 */
+			template <typename InputIterator>
+			void range_init(InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			template <typename ForwardIterator>
+			void range_init(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type n = ft::distance(first, last);
+				if (n > this->max_size())
+					throw(std::length_error("Error: ft::vector::vector"));
+				this->_start = this->_alloc.allocate(n);
+				this->_end = this->_start;
+				this->_end_of_capacity = this->_start + n;
+				for (; first != last; ++first)
+					this->_alloc.construct(this->_end++, *first);
+			}
+
+			template <typename InputIterator>
+			void range_assign(InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				this->clear();
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			template <typename ForwardIterator>
+			void range_assign(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type n = ft::distance(first, last);
+				this->clear();
+				if (n > this->capacity())
+				{
+					if (n > this->max_size())
+						throw(std::length_error("Error: ft::vector::assign"));
+					pointer new_start = this->_alloc.allocate(n);
+					this->_alloc.deallocate(this->_start, this->_end_of_capacity - this->_start);
+					this->_start = new_start;
+					this->_end = new_start;
+					this->_end_of_capacity = new_start + n;
+				}
+				for (; first != last; ++first)
+					this->_alloc.construct(this->_end++, *first);
+			}
+
+			//뒤에 붙이는 경우는 하나씩 push_back, 중간이면 임시 vector에 모은 뒤 forward 경로로 넣는다.
+			template <typename InputIterator>
+			void range_insert(iterator position, InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				if (position.base() == this->_end)
+				{
+					for (; first != last; ++first)
+						this->push_back(*first);
+					return ;
+				}
+				vector tmp(first, last, this->_alloc);
+				this->range_insert(position, tmp.begin(), tmp.end(), ft::random_access_iterator_tag());
+			}
+
+			template <typename ForwardIterator>
+			void range_insert(iterator position, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type n = ft::distance(first, last);
+				if (n == 0)
+					return ;
+				if (this->size() + n <= this->capacity() && ft::is_memmove_relocatable<value_type, allocator_type>::value)
+				{
+					pointer pos = position.base();
+					this->shift_back(pos, n);
+					while (n--)
+						this->_alloc.construct(pos++, *first++);
+				}
+				else if (this->size() + n <= this->capacity())
+				{
+					pointer val_tmp = this->_end;
+					pointer old_end = this->_end;
+					pointer pos = position.base();
+					size_type range = this->_end - pos;
+					this->_end += n;
+					pointer tmp = this->_end;
+					while (range--)
+					{
+						if (--tmp < old_end)
+							this->_alloc.destroy(tmp);
+						this->_alloc.construct(tmp, FT_MOVE(*(--val_tmp)));
+					}
+					//앞에서부터 채운다. -> forward iterator도 된다.
+					for (; first != last; ++first, ++pos)
+					{
+						if (pos < old_end)
+							this->_alloc.destroy(pos);
+						this->_alloc.construct(pos, *first);
+					}
+				}
+				else if (this->grows_in_place(position.base()))
+				{
+					this->reserve(this->recommend(this->size() + n));
+					for (; first != last; ++first)
+						this->_alloc.construct(this->_end++, *first);
+				}
+				else
+				{
+					pointer prev_start = this->_start;
+					pointer prev_end_of_capacity = this->_end_of_capacity;
+					size_type _size = this->recommend(n + this->size());
+					size_type front_tmp = position.base() - this->_start;
+					size_type back_tmp = this->_end - position.base();
+					this->_start = this->_alloc.allocate(_size);
+					this->_end_of_capacity = this->_start + _size;
+					//새 원소를 먼저 만든다. -> val(또는 range)가 이 vector의 원소여도 안전하다.
+					pointer mid = this->_start + front_tmp;
+					for (size_type i = 0; i < n; ++i)
+						_alloc.construct(mid + i, *first++);
+					this->relocate(this->_start, prev_start, prev_start + front_tmp);
+					this->relocate(mid + n, prev_start + front_tmp, prev_start + front_tmp + back_tmp);
+					this->_end = mid + n + back_tmp;
+					this->_alloc.deallocate(prev_start, prev_end_of_capacity - prev_start);
+				}
+			}
+
+#ifdef FT_CXX11
+			//새 저장공간의 position 자리에 원소를 먼저 만들고 나머지 원소를 옮긴다.
+			//-> args가 이 vector의 원소를 가리켜도 안전하다.
+			template <class... Args>
+			void realloc_emplace(pointer position, Args&&... args)
+			{
+				if (this->grows_in_place(position))
+				{
+					value_type tmp(std::forward<Args>(args)...);
+					this->reserve(this->recommend(this->size() + 1));
+					this->_alloc.construct(this->_end++, std::move(tmp));
+					return ;
+				}
+				size_type front = position - this->_start;
+				size_type _size = this->recommend(this->size() + 1);
+				pointer new_start = this->_alloc.allocate(_size);
+				try
+				{
+					this->_alloc.construct(new_start + front, std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					this->_alloc.deallocate(new_start, _size);
+					throw;
+				}
+				this->relocate(new_start, this->_start, position);
+				this->relocate(new_start + front + 1, position, this->_end);
+				size_type n = this->size() + 1;
+				this->_alloc.deallocate(this->_start, this->_end_of_capacity - this->_start);
+				this->_start = new_start;
+				this->_end = new_start + n;
+				this->_end_of_capacity = new_start + _size;
+			}
+#endif
+
 		public:
 
 		/**
@@ -177,10 +639,9 @@ namespace ft
 		: _alloc(alloc), _start(NULL), _end(NULL), _end_of_capacity(NULL)
 		{
 			this->_start = this->_alloc.allocate(n);
-			this->_end = this->_start;
+			this->construct_fill(this->_start, n, val); //각 요소는 val의 복사본
+			this->_end = this->_start + n;
 			this->_end_of_capacity = this->_start + n;
-			while (n--)
-				this->_alloc.construct(this->_end++, val); //각 요소는 val의 복사본
 		}
 
 		//range constructor
@@ -190,15 +651,7 @@ namespace ft
 				typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
 		: _alloc(alloc), _start(NULL), _end(NULL), _end_of_capacity(NULL)
 		{
-			//type
-			difference_type n = ft::distance(first, last);
-			// while (first++ != last)
-			//   n++;
-			this->_start = this->_alloc.allocate(n);
-			this->_end = this->_start;
-			this->_end_of_capacity = this->_start + n;
-			while (n--)
-				this->_alloc.construct(this->_end++, *first++);
+			this->range_init(first, last, ft::iterator_category(first));
 		}
 
 		//copy constructor
@@ -232,6 +685,36 @@ namespace ft
 			return (*this);
 		}
 
+#ifdef FT_CXX11
+		//move constructor
+		//x의 저장공간을 그대로 가져온다. x는 빈 vector가 된다.
+		vector(vector &&x)
+		: _alloc(x._alloc), _start(x._start), _end(x._end), _end_of_capacity(x._end_of_capacity)
+		{
+			x._start = NULL;
+			x._end = NULL;
+			x._end_of_capacity = NULL;
+		}
+
+		//move assignment operator
+		vector &operator=(vector &&x)
+		{
+			if (this != &x)
+			{
+				this->clear();
+				this->_alloc.deallocate(this->_start, this->_end_of_capacity - this->_start);
+				this->_alloc = x._alloc;
+				this->_start = x._start;
+				this->_end = x._end;
+				this->_end_of_capacity = x._end_of_capacity;
+				x._start = NULL;
+				x._end = NULL;
+				x._end_of_capacity = NULL;
+			}
+			return (*this);
+		}
+#endif
+
 		/**
 		 * @brief Iterator
 		 * cbegin, cend, crbegin, crend is c++11
@@ -280,7 +763,7 @@ namespace ft
 
 		/**
 		 * @brief capacity
-		 * shringk_to_fit is c++11
+		 * shrink_to_fit is c++11
 		 */
 		//return size
 		size_type size() const
@@ -307,6 +790,24 @@ namespace ft
 				insert(_end, n - size(), val);
 		}
 
+		/**
+		 * @brief resize_default_init
+		 * 표준에 없는 확장. resize(n)과 같지만 새 원소를 value-initialization(0으로 채움) 대신 default-initialization한다.
+		 * 기본 생성자가 trivial한 원소(char, unsigned char 등)는 값을 쓰지 않고 크기만 늘린다. -> 새 원소의 값은 정해지지 않는다.
+		 * read() 같은 syscall이 바로 덮어쓸 buffer를 늘릴 때 바이트당 비용이 없다.
+		 * ex) buf.resize_default_init(used + chunk); n = read(fd, &buf[0] + used, chunk); buf.resize(used + n);
+		 * 그 외의 원소는 resize(n)과 같다.
+		 */
+		void resize_default_init(size_type n)
+		{
+			if (!(ft::is_trivially_default_constructible<value_type>::value
+				&& ft::is_trivially_destroyable<value_type, allocator_type>::value))
+				return (this->resize(n));
+			if (n > this->capacity())
+				this->reserve(this->recommend(n));
+			this->_end = this->_start + n;
+		}
+
 		//Return size of allocated storage capacity
 		//element의 갯수가 아닌, 할당받은 메모리의 갯수. (잠재적 크기)
 		size_type capacity() const
@@ -328,22 +829,24 @@ namespace ft
 			if (n > max_size()) //최대 크기를 넘어가면 에러
 				throw(std::length_error("Error: ft::vector::reserve"));
 			else if (n > this->capacity())
-			{
-				pointer prev_start = this->_start;
-				pointer prev_end = this->_end;
-				pointer prev_end_of_capacity = this->_end_of_capacity;
+				this->reallocate_storage(n, integral_traits<ft::is_reallocatable<value_type, allocator_type>::value, bool>());
+		}
 
-				this->_start = this->_alloc.allocate(n);
-				this->_end = this->_start;
-				this->_end_of_capacity = this->_start + n;
-				pointer tmp = prev_start;
-				while (tmp != prev_end)
-				{
-					this->_alloc.construct(this->_end++, *tmp);
-					this->_alloc.destroy(tmp++);
-				}
-				this->_alloc.deallocate(prev_start, prev_end_of_capacity - prev_start);
-			}
+		//capacity를 size로 줄인다. (c++11) 일시적으로 커졌던 vector가 남는 메모리를 반환한다.
+		void shrink_to_fit()
+		{
+			if (this->_end == this->_end_of_capacity)
+				return ;
+			pointer prev_start = this->_start;
+			pointer prev_end = this->_end;
+			pointer prev_end_of_capacity = this->_end_of_capacity;
+			size_type n = this->size();
+
+			this->_start = n ? this->_alloc.allocate(n) : NULL;
+			this->_end = this->_start + n;
+			this->_end_of_capacity = this->_start + n;
+			this->relocate(this->_start, prev_start, prev_end);
+			this->_alloc.deallocate(prev_start, prev_end_of_capacity - prev_start);
 		}
 
 		/**
@@ -422,66 +925,62 @@ namespace ft
 		void assign(InputIterator first, InputIterator last,
 					typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type * = NULL)
 		{
-			this->clear();
-			size_type n = ft::distance(first, last);
-			if (n <= this->capacity())
-			{
-				while (n--)
-					this->_alloc.construct(this->_end++, *first++);
-			}
-			else
-			{
-				pointer prev_start = this->_start;
-				pointer prev_end_of_capacity = this->_end_of_capacity;
-
-				this->_start = this->_alloc.allocate(n);
-				this->_end = this->_start;
-				this->_end_of_capacity = this->_start + n;
-				const_pointer tmp = &(*first);
-				while(tmp != &(*last))
-					this->_alloc.construct(this->_end++, *tmp++);
-				this->_alloc.deallocate(prev_start, prev_end_of_capacity - prev_start);
-			}
+			this->range_assign(first, last, ft::iterator_category(first));
 		}
 
 		//assign range
 		void assign(size_type n, const value_type &val)
 		{
+			//val이 이 vector의 원소일 수 있으므로 먼저 복사해 둔다.
+			value_type copy(val);
 			this->clear();
 			if (n <= this->capacity())
-			{
-				while (n--)
-					this->_alloc.construct(this->_end++, val);
-			}
+				this->construct_fill(this->_start, n, copy);
 			else
 			{
 				pointer prev_start = this->_start;
 				pointer prev_end_of_capacity = this->_end_of_capacity;
 
 				this->_start = this->_alloc.allocate(n);
-				this->_end = this->_start;
 				this->_end_of_capacity = this->_start + n;
-				while (n--)
-					this->_alloc.construct(this->_end++, val);
+				this->construct_fill(this->_start, n, copy);
 				this->_alloc.deallocate(prev_start, prev_end_of_capacity - prev_start);
 			}
+			this->_end = this->_start + n;
 		}
 
 		// 벡터의 뒤에 새로운 element를 추가한다.
-		// 늘어난 벡터의 크기가 capacity를 넘어갈 경우, 이전 capacity * 2의 크기로
-		// 늘어남.
+		// 늘어난 벡터의 크기가 capacity를 넘어갈 경우, growth factor만큼 늘어남.
 		void push_back(const value_type &val)
 		{
 			if (this->_end == this->_end_of_capacity)
 			{
-				if (this->size() == 0)
-					this->reserve(1);
-				else
-					this->reserve(this->capacity() * 2);
+				//val이 이 vector의 원소일 수 있으므로 재할당 전에 복사해 둔다.
+				value_type tmp(val);
+				this->reserve(this->recommend(this->size() + 1));
+				this->_alloc.construct(this->_end++, FT_MOVE(tmp));
+				return ;
 			}
 			this->_alloc.construct(this->_end++, val);
 		}
 
+#ifdef FT_CXX11
+		void push_back(value_type &&val)
+		{
+			this->emplace_back(std::move(val));
+		}
+
+		//args로 원소를 맨 뒤에 바로 생성한다. (c++11)
+		template <class... Args>
+		void emplace_back(Args&&... args)
+		{
+			if (this->_end == this->_end_of_capacity)
+				this->realloc_emplace(this->_end, std::forward<Args>(args)...);
+			else
+				this->_alloc.construct(this->_end++, std::forward<Args>(args)...);
+		}
+#endif
+
 		// 벡터의 맨 뒤 요소를 하나 제거한다.
 		void pop_back()
 		{
@@ -496,102 +995,129 @@ namespace ft
 		//1.single element insert
 		iterator insert(iterator position, const value_type &val)
 		{
-			size_type n = &(*position) - this->_start;
+			size_type n = position.base() - this->_start;
 			this->insert(position, 1, val);
 			return (this->begin() + n);
 		}
 
+#ifdef FT_CXX11
+		iterator insert(iterator position, value_type &&val)
+		{
+			return (this->emplace(position, std::move(val)));
+		}
+
+		//args로 원소를 position 앞에 생성한다. (c++11)
+		template <class... Args>
+		iterator emplace(iterator position, Args&&... args)
+		{
+			pointer pos = position.base();
+			size_type n = pos - this->_start;
+			if (this->_end == this->_end_of_capacity)
+				this->realloc_emplace(pos, std::forward<Args>(args)...);
+			else if (pos == this->_end)
+				this->_alloc.construct(this->_end++, std::forward<Args>(args)...);
+			else
+			{
+				//args가 옮겨질 원소를 가리킬 수 있으므로 먼저 만든다.
+				value_type tmp(std::forward<Args>(args)...);
+				if (ft::is_memmove_relocatable<value_type, allocator_type>::value)
+					this->shift_back(pos, 1);
+				else
+				{
+					//한 칸씩 뒤로 move한다.
+					pointer p = this->_end;
+					this->_alloc.construct(p, std::move(*(p - 1)));
+					while (--p != pos)
+					{
+						this->_alloc.destroy(p);
+						this->_alloc.construct(p, std::move(*(p - 1)));
+					}
+					this->_alloc.destroy(pos);
+					++this->_end;
+				}
+				this->_alloc.construct(pos, std::move(tmp));
+			}
+			return (this->begin() + n);
+		}
+#endif
+
 		//2.fill element insert
 		void insert(iterator position, size_type n, const value_type &val)
 		{
-			if (this->size() + n <= this->capacity())
+			//n == 0이면 아래 경로가 원소를 자기 자신으로 옮긴다.
+			if (n == 0)
+				return ;
+			if (this->size() + n <= this->capacity() && ft::is_memmove_relocatable<value_type, allocator_type>::value)
 			{
+				//val이 옮겨질 원소일 수 있으므로 먼저 복사해 둔다.
+				value_type copy(val);
+				pointer pos = position.base();
+				this->shift_back(pos, n);
+				this->construct_fill(pos, n, copy);
+			}
+			else if (this->size() + n <= this->capacity())
+			{
+				value_type copy(val);
+				//뒤에서부터 옮긴다. 이미 원소가 있는 자리는 먼저 소멸시킨다.
 				pointer val_tmp = this->_end;
-				size_type range = this->_end - &(*position);
+				pointer old_end = this->_end;
+				size_type range = this->_end - position.base();
 				this->_end += n;
 				pointer tmp = this->_end;
 				while (range--)
-					this->_alloc.construct(--tmp, *(--val_tmp));
-				while (n--)
-					this->_alloc.construct(--tmp, val);
-			}
-			else
-			{
-				pointer tmp = this->_start;
-				size_type _size = n + this->size();
-				size_type front_tmp = &(*position) - this->_start;
-				size_type back_tmp = _end - &(*position);
-				this->_start = _alloc.allocate(_size);
-				this->_end = _start;
-				this->_end_of_capacity = this->_start + _size;
-				while (front_tmp--)
 				{
-					_alloc.construct(this->_end++, *tmp);
-					_alloc.destroy(tmp++);
+					if (--tmp < old_end)
+						this->_alloc.destroy(tmp);
+					this->_alloc.construct(tmp, FT_MOVE(*(--val_tmp)));
 				}
 				while (n--)
-					_alloc.construct(this->_end++, val);
-				while (back_tmp--)
 				{
-					_alloc.construct(this->_end++, *tmp);
-					_alloc.destroy(tmp++);
+					if (--tmp < old_end)
+						this->_alloc.destroy(tmp);
+					this->_alloc.construct(tmp, copy);
 				}
 			}
-		}
-
-		//3.range element instert
-		template < typename InputIterator >
-		void insert(iterator position, InputIterator first, InputIterator last,
-			typename ft::enable_if< !ft::is_integral< InputIterator >::value >::type* = NULL)
-		{
-			size_type n = ft::distance(first, last);
-			if (this->size() + n <= this->capacity())
+			else if (this->grows_in_place(position.base()))
 			{
-				pointer val_tmp = this->_end;
-				size_type range = this->_end - &(*position);
+				//val이 이 vector의 원소일 수 있으므로 먼저 복사해 둔다.
+				value_type copy(val);
+				this->reserve(this->recommend(this->size() + n));
+				this->construct_fill(this->_end, n, copy);
 				this->_end += n;
-				pointer tmp = this->_end;
-				while (range--)
-					this->_alloc.construct(--tmp, *(--val_tmp));
-				while (n--)
-					this->_alloc.construct(--tmp, *(--last));
 			}
 			else
 			{
-				pointer tmp = this->_start;
-				size_type _size = n + this->size();
-				size_type front_tmp = &(*position) - this->_start;
-				size_type back_tmp = this->_end - &(*position);
+				pointer prev_start = this->_start;
+				pointer prev_end_of_capacity = this->_end_of_capacity;
+				size_type _size = this->recommend(n + this->size());
+				size_type front_tmp = position.base() - this->_start;
+				size_type back_tmp = _end - position.base();
 				this->_start = this->_alloc.allocate(_size);
-				this->_end = this->_start;
 				this->_end_of_capacity = this->_start + _size;
-				while (front_tmp--)
-				{
-					_alloc.construct(this->_end++, *tmp);
-					_alloc.destroy(tmp++);
-				}
-				while (n--)
-					_alloc.construct(this->_end++, *first++);
-				while (back_tmp--)
-				{
-					_alloc.construct(this->_end++, *tmp);
-					_alloc.destroy(tmp++);
-				}
+				//새 원소를 먼저 만든다. -> val(또는 range)가 이 vector의 원소여도 안전하다.
+				pointer mid = this->_start + front_tmp;
+				this->construct_fill(mid, n, val);
+				this->relocate(this->_start, prev_start, prev_start + front_tmp);
+				this->relocate(mid + n, prev_start + front_tmp, prev_start + front_tmp + back_tmp);
+				this->_end = mid + n + back_tmp;
+				this->_alloc.deallocate(prev_start, prev_end_of_capacity - prev_start);
 			}
 		}
 
+		//3.range element instert
+		template < typename InputIterator >
+		void insert(iterator position, InputIterator first, InputIterator last,
+			typename ft::enable_if< !ft::is_integral< InputIterator >::value >::type* = NULL)
+		{
+			this->range_insert(position, first, last, ft::iterator_category(first));
+		}
+
 		//단일 요소(위치) 제거
 		iterator erase(iterator position)
 		{
-			this->_alloc.destroy(&(*position));
-			size_type n = this->_end - &(*position) - 1;
-			pointer tmp = &(*position);
-
-			while (n--)
-			{
-				this->_alloc.construct(tmp, *(tmp + 1));
-				this->_alloc.destroy(tmp++);
-			}
+			this->_alloc.destroy(position.base());
+			//한 칸 앞으로 복사한 뒤 원래 자리의 원소를 소멸시킨다.
+			this->relocate(position.base(), position.base() + 1, this->_end);
 			--this->_end;
 			return (position);
 		}
@@ -599,36 +1125,38 @@ namespace ft
 		//범위[first, last) 제거
 		iterator erase(iterator first, iterator last)
 		{
-			pointer tmp = &(*first);
-			while (tmp != &(*last))
-				_alloc.destroy(tmp++);
-			size_type n = this->_end - &(*last);
-			size_type range = ft::distance(first, last);
-			tmp = &(*first);
-			while (n--)
-			{
-				_alloc.construct(tmp, *last++);
-				_alloc.destroy(tmp++);
-			}
-			this->_end -= range;
+			if (first == last)
+				return (first);
+			this->destroy_range(first.base(), last.base());
+			this->relocate(first.base(), last.base(), this->_end);
+			this->_end -= last.base() - first.base();
 			return (first);
 		}
 
+		//pointer 세 개만 바꾼다. -> 원소 수와 관계없이 O(1)이고, T에 operator==가 필요 없다.
+		//allocator는 c++11부터 propagate_on_container_swap일 때만 바꾼다. (c++98은 항상 바꾼다)
+		//바꾸지 않는 allocator끼리는 같아야 한다. (다르면 std와 마찬가지로 undefined)
 		void swap(vector &x) {
-			if (*this == x)
+			if (this == &x)
 				return ;
 
-			allocator_type tmp_alloc = x._alloc;
+#ifdef FT_CXX11
+			if (std::allocator_traits<allocator_type>::propagate_on_container_swap::value)
+#endif
+			{
+				allocator_type tmp_alloc = x._alloc;
+				x._alloc = this->_alloc;
+				this->_alloc = tmp_alloc;
+			}
+
 			pointer tmp_start = x._start;
 			pointer tmp_end = x._end;
 			pointer tmp_end_of_capacity = x._end_of_capacity;
 
-			x._alloc = this->_alloc;
 			x._start = this->_start;
 			x._end = this->_end;
 			x._end_of_capacity = this->_end_of_capacity;
 
-			this->_alloc = tmp_alloc;
 			this->_start = tmp_start;
 			this->_end = tmp_end;
 			this->_end_of_capacity = tmp_end_of_capacity;
@@ -636,8 +1164,8 @@ namespace ft
 
 		void clear()
 		{
-			while (this->_start != this->_end)
-				this->_alloc.destroy(--this->_end);
+			this->destroy_range(this->_start, this->_end);
+			this->_end = this->_start;
 		}
 
 		//allocator
@@ -0,0 +1,97 @@
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+#include <sys/time.h>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+//operator new/delete 교체용 예외 명세. c++17은 throw(std::bad_alloc)를 허용하지 않는다.
+#if __cplusplus >= 201103L
+# define BENCH_THROW_BAD_ALLOC
+# define BENCH_NOTHROW noexcept
+#else
+# define BENCH_THROW_BAD_ALLOC throw(std::bad_alloc)
+# define BENCH_NOTHROW throw()
+#endif
+
+/**
+ * @brief benchmark helpers
+ *
+ * ft 컨테이너와 std 컨테이너를 같은 입력으로 돌려 걸린 시간을 비교하기 위한 도구.
+ * 입력은 고정된 seed의 LCG로 만들기 때문에 ft/std 모두 같은 순서의 key를 받는다.
+ */
+namespace bench
+{
+	//wall-clock timer (ms)
+	class Timer
+	{
+		private:
+			struct timeval	_start;
+
+		public:
+			Timer() { reset(); }
+
+			void reset()
+			{
+				gettimeofday(&this->_start, NULL);
+			}
+
+			double ms() const
+			{
+				struct timeval now;
+				gettimeofday(&now, NULL);
+				return ((now.tv_sec - this->_start.tv_sec) * 1000.0 + (now.tv_usec - this->_start.tv_usec) / 1000.0);
+			}
+	};
+
+	//deterministic pseudo random generator
+	class Random
+	{
+		private:
+			unsigned long	_state;
+
+		public:
+			explicit Random(unsigned long seed = 42) : _state(seed) {}
+
+			unsigned long next()
+			{
+				this->_state = this->_state * 6364136223846793005UL + 1442695040888963407UL;
+				return (this->_state >> 17);
+			}
+	};
+
+	//결과가 최적화로 사라지지 않도록 값을 흘려보낸다.
+	inline void sink(long value)
+	{
+		static volatile long s;
+		s += value;
+	}
+
+	//첫 번째 인자로 최대 원소 수를 받는다. 없으면 def를 사용한다.
+	inline long max_elements(int argc, char** argv, long def)
+	{
+		if (argc > 1)
+			return (std::atol(argv[1]));
+		return (def);
+	}
+
+	inline void title(const std::string& name)
+	{
+		std::cout << "\n===== " << name << " =====" << std::endl;
+	}
+
+	//두 결과를 나란히 출력한다. 괄호 안은 a / b 시간 비율
+	inline void report(const std::string& name, long n, double ft_ms, double std_ms,
+						const std::string& a = "ft", const std::string& b = "std")
+	{
+		std::cout << std::left << std::setw(28) << name
+			<< " n=" << std::setw(10) << n
+			<< " " << a << ": " << std::right << std::setw(10) << std::fixed << std::setprecision(2) << ft_ms << " ms"
+			<< "   " << b << ": " << std::setw(10) << std_ms << " ms"
+			<< "   (x" << std::setprecision(2) << (std_ms > 0 ? ft_ms / std_ms : 0) << ")" << std::endl;
+	}
+}
+
+#endif
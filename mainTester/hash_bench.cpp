@@ -0,0 +1,313 @@
+#include "map.hpp"
+#include "unordered_map.hpp"
+#include "bench.hpp"
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <cstdio>
+#include <new>
+#include <cstdlib>
+#if __cplusplus >= 201103L
+# include <unordered_map>
+#else
+# include <tr1/unordered_map>
+#endif
+
+/**
+ * unordered_map benchmark
+ * usage: ./hash_bench [max_elements]
+ * 10^3 부터 max_elements(기본 10^6)까지 10배씩 늘리며 ft::unordered_map을 ft::map, std::unordered_map과 비교한다.
+ * c++98에는 std::unordered_map이 없으므로 std::tr1::unordered_map을 사용한다.
+ *
+ * 마지막으로 같은 HashTable을 SIMD group(compile time에 고른 HashGroup)과 portable group으로 만들어 탐색 비용을 비교한다.
+ * AVX2 group: make bench BENCH_FLAGS="-O2 -DNDEBUG -mavx2 -DFT_HASH_AVX2"
+ */
+
+#define QUERIES 1000000
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+# pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+//heap 사용량 측정을 위해 operator new를 교체해 할당 바이트 수를 센다.
+static size_t	g_alloc_bytes = 0;
+
+void* operator new(std::size_t size) BENCH_THROW_BAD_ALLOC
+{
+	g_alloc_bytes += size;
+	void* p = std::malloc(size);
+	if (p == NULL)
+		throw std::bad_alloc();
+	return (p);
+}
+
+void operator delete(void* p) BENCH_NOTHROW
+{
+	std::free(p);
+}
+
+//c++14부터는 크기를 받는 operator delete도 같이 교체해야 한다.
+#if __cplusplus >= 201402L
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+#endif
+
+typedef ft::unordered_map<int, int>	ft_hash_map;
+typedef ft::map<int, int>	ft_map;
+#if __cplusplus >= 201103L
+typedef std::unordered_map<int, int>	std_hash_map;
+typedef std::unordered_map<std::string, int>	std_string_hash_map;
+#else
+typedef std::tr1::unordered_map<int, int>	std_hash_map;
+typedef std::tr1::unordered_map<std::string, int>	std_string_hash_map;
+#endif
+
+//hash vs rbtree, hash vs std 두 줄로 출력한다.
+void report(const std::string& name, long n, double hash_ms, double ft_ms, double std_ms)
+{
+	bench::report(name, n, hash_ms, ft_ms, "hash", "rbtree");
+	bench::report(name, n, hash_ms, std_ms, "hash", "std");
+}
+
+template <typename Map, typename Pair, typename Key>
+void fill(Map& mp, const std::vector<Key>& keys)
+{
+	for (size_t i = 0; i < keys.size(); ++i)
+		mp.insert(Pair(keys[i], static_cast<int>(i)));
+}
+
+template <typename Map, typename Pair>
+double run_insert(const std::vector<int>& keys, bool reserve)
+{
+	bench::Timer timer;
+	Map mp;
+	if (reserve)
+		mp.rehash(keys.size());
+	fill<Map, Pair>(mp, keys);
+	bench::sink(static_cast<long>(mp.size()));
+	return (timer.ms());
+}
+
+//ft::map에는 reserve가 없으므로 그냥 삽입한다.
+template <>
+double run_insert<ft_map, ft::pair<int, int> >(const std::vector<int>& keys, bool)
+{
+	bench::Timer timer;
+	ft_map mp;
+	fill<ft_map, ft::pair<int, int> >(mp, keys);
+	bench::sink(static_cast<long>(mp.size()));
+	return (timer.ms());
+}
+
+template <typename Map, typename Key>
+double run_find(const Map& mp, const std::vector<Key>& queries)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (size_t i = 0; i < queries.size(); ++i)
+	{
+		typename Map::const_iterator it = mp.find(queries[i]);
+		if (it != mp.end())
+			sum += it->second;
+	}
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+//있는 key를 지우고 새 key를 넣는다. -> 원소 수는 그대로, tombstone이 계속 생긴다.
+template <typename Map, typename Pair>
+double run_churn(Map& mp, const std::vector<int>& keys, long rounds)
+{
+	bench::Timer timer;
+	int next = static_cast<int>(keys.size()) * 4;
+	for (long i = 0; i < rounds; ++i)
+	{
+		mp.erase(keys[i % keys.size()]);
+		mp.insert(Pair(next + static_cast<int>(i), 0));
+		mp.insert(Pair(keys[i % keys.size()], 0));
+		mp.erase(next + static_cast<int>(i));
+	}
+	bench::sink(static_cast<long>(mp.size()));
+	return (timer.ms());
+}
+
+template <typename Map>
+double run_scan(const Map& mp, long rounds)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (long r = 0; r < rounds; ++r)
+	{
+		for (typename Map::const_iterator it = mp.begin(); it != mp.end(); ++it)
+			sum += it->second;
+	}
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+template <typename Map, typename Pair>
+double bytes_per_element(const std::vector<int>& keys)
+{
+	size_t bytes = g_alloc_bytes;
+	Map mp;
+	fill<Map, Pair>(mp, keys);
+	return (static_cast<double>(g_alloc_bytes - bytes) / mp.size());
+}
+
+//random key n개 (0 ~ 2^31)
+//hit 쿼리는 넣은 key 중에서, miss 쿼리는 넣지 않은 홀수 key로 만든다. (넣은 key는 짝수)
+void bench_int(long n)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	std::vector<int> hits;
+	std::vector<int> misses;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next() & 0x3FFFFFFF) * 2);
+	for (long i = 0; i < QUERIES; ++i)
+	{
+		hits.push_back(keys[rand.next() % n]);
+		misses.push_back(static_cast<int>(rand.next() & 0x3FFFFFFF) * 2 + 1);
+	}
+	long rounds = std::max(1L, 10000000L / n);
+
+	report("insert", n, run_insert<ft_hash_map, ft::pair<int, int> >(keys, false),
+		run_insert<ft_map, ft::pair<int, int> >(keys, false), run_insert<std_hash_map, std::pair<int, int> >(keys, false));
+	bench::report("insert (reserved)", n, run_insert<ft_hash_map, ft::pair<int, int> >(keys, true),
+		run_insert<std_hash_map, std::pair<int, int> >(keys, true), "hash", "std");
+
+	ft_hash_map hash_mp;
+	ft_map ft_mp;
+	std_hash_map std_mp;
+	fill<ft_hash_map, ft::pair<int, int> >(hash_mp, keys);
+	fill<ft_map, ft::pair<int, int> >(ft_mp, keys);
+	fill<std_hash_map, std::pair<int, int> >(std_mp, keys);
+	report("find (hit)", n, run_find(hash_mp, hits), run_find(ft_mp, hits), run_find(std_mp, hits));
+	report("find (miss)", n, run_find(hash_mp, misses), run_find(ft_mp, misses), run_find(std_mp, misses));
+	report("scan", n, run_scan(hash_mp, rounds), run_scan(ft_mp, rounds), run_scan(std_mp, rounds));
+	report("erase/insert churn", n, run_churn<ft_hash_map, ft::pair<int, int> >(hash_mp, keys, QUERIES),
+		run_churn<ft_map, ft::pair<int, int> >(ft_mp, keys, QUERIES), run_churn<std_hash_map, std::pair<int, int> >(std_mp, keys, QUERIES));
+	//churn 이후에도 조회가 느려지지 않는지 확인한다. (tombstone)
+	report("find (hit, after churn)", n, run_find(hash_mp, hits), run_find(ft_mp, hits), run_find(std_mp, hits));
+}
+
+void bench_memory(long n)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next() & 0x3FFFFFFF));
+	double hash_bytes = bytes_per_element<ft_hash_map, ft::pair<int, int> >(keys);
+	double ft_bytes = bytes_per_element<ft_map, ft::pair<int, int> >(keys);
+	double std_bytes = bytes_per_element<std_hash_map, std::pair<int, int> >(keys);
+	std::cout << "memory per element         n=" << std::setw(10) << std::left << n << std::right
+		<< " hash: " << std::setw(7) << hash_bytes << " bytes"
+		<< "   rbtree: " << std::setw(7) << ft_bytes << " bytes"
+		<< "   std: " << std::setw(7) << std_bytes << " bytes" << std::endl;
+}
+
+void bench_string(long n)
+{
+	bench::Random rand;
+	std::vector<std::string> keys;
+	std::vector<std::string> queries;
+	char buf[32];
+	for (long i = 0; i < n; ++i)
+	{
+		std::sprintf(buf, "key-%lu", rand.next());
+		keys.push_back(buf);
+	}
+	for (long i = 0; i < QUERIES; ++i)
+		queries.push_back(keys[rand.next() % n]);
+
+	ft::unordered_map<std::string, int> hash_mp;
+	ft::map<std::string, int> ft_mp;
+	std_string_hash_map std_mp;
+	fill<ft::unordered_map<std::string, int>, ft::pair<std::string, int> >(hash_mp, keys);
+	fill<ft::map<std::string, int>, ft::pair<std::string, int> >(ft_mp, keys);
+	fill<std_string_hash_map, std::pair<std::string, int> >(std_mp, keys);
+	report("string find (hit)", n, run_find(hash_mp, queries), run_find(ft_mp, queries), run_find(std_mp, queries));
+}
+
+typedef ft::HashTable<int, ft::hash<int>, ft::equal_to<int>, std::allocator<int> >	simd_table;
+typedef ft::HashTable<int, ft::hash<int>, ft::equal_to<int>, std::allocator<int>, ft::HashGroupPortable>	portable_table;
+
+template <typename Table>
+double run_probe(const Table& table, const std::vector<int>& queries)
+{
+	bench::Timer timer;
+	long found = 0;
+	for (size_t i = 0; i < queries.size(); ++i)
+		found += (table.find(queries[i]) != table.end());
+	bench::sink(found);
+	return (timer.ms());
+}
+
+template <typename Table>
+void fill_table(Table& table, const std::vector<int>& keys, size_t capacity)
+{
+	table.max_load_factor(1.0f);
+	table.rehash(capacity);
+	for (size_t i = 0; i < keys.size(); ++i)
+		table.insert(keys[i]);
+}
+
+//capacity를 고정하고 load factor만큼 채운 뒤 hit/miss/mixed(반반) 쿼리의 탐색 시간
+void bench_probe(size_t capacity, double load)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	std::vector<int> hits;
+	std::vector<int> misses;
+	std::vector<int> mixed;
+	long n = static_cast<long>(capacity * load);
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next() & 0x3FFFFFFF) * 2);
+	for (long i = 0; i < QUERIES; ++i)
+	{
+		hits.push_back(keys[rand.next() % n]);
+		misses.push_back(static_cast<int>(rand.next() & 0x3FFFFFFF) * 2 + 1);
+		mixed.push_back(rand.next() % 2 ? hits.back() : misses.back());
+	}
+
+	simd_table simd;
+	portable_table portable;
+	fill_table(simd, keys, capacity);
+	fill_table(portable, keys, capacity);
+	char name[64];
+	std::sprintf(name, "hit   (load %.3f)", simd.load_factor());
+	bench::report(name, n, run_probe(simd, hits), run_probe(portable, hits), ft::HashGroup::name(), "portable");
+	std::sprintf(name, "miss  (load %.3f)", simd.load_factor());
+	bench::report(name, n, run_probe(simd, misses), run_probe(portable, misses), ft::HashGroup::name(), "portable");
+	std::sprintf(name, "mixed (load %.3f)", simd.load_factor());
+	bench::report(name, n, run_probe(simd, mixed), run_probe(portable, mixed), ft::HashGroup::name(), "portable");
+}
+
+int main(int argc, char** argv)
+{
+	long max_n = bench::max_elements(argc, argv, 1000000);
+
+	bench::title("int keys: insert | find (1M queries) | scan (10M elements visited) | churn (1M rounds)");
+	for (long n = 1000; n <= max_n; n *= 10)
+		bench_int(n);
+
+	bench::title("memory");
+	for (long n = 1000; n <= max_n; n *= 10)
+		bench_memory(n);
+
+	bench::title("string keys (1M queries)");
+	for (long n = 1000; n <= max_n; n *= 10)
+		bench_string(n);
+
+	//작은 table(cache 안)과 큰 table(cache 밖)
+	const double loads[] = {0.25, 0.5, 0.75, 0.875, 0.97};
+	bench::title(std::string("group probing: ") + ft::HashGroup::name() + " vs portable (1M queries)");
+	for (size_t capacity = (1 << 14) - 1; capacity < static_cast<size_t>(max_n) * 8; capacity = capacity * 256 + 255)
+	{
+		for (size_t i = 0; i < sizeof(loads) / sizeof(loads[0]); ++i)
+			bench_probe(capacity, loads[i]);
+	}
+	return (0);
+}
@@ -0,0 +1,672 @@
+#include "map.hpp"
+#include "btree_map.hpp"
+#include "flat_map.hpp"
+#include "bench.hpp"
+#include <map>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <string>
+#include <cstdio>
+#include <new>
+#include <cstdlib>
+
+/**
+ * map benchmark
+ * usage: ./map_bench [max_elements]
+ * 10^3 부터 max_elements(기본 10^7)까지 100배씩 늘리며 ft::map과 std::map을 비교한다.
+ */
+
+#define QUERIES 1000000
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+# pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+//heap 사용량 측정을 위해 operator new를 교체해 할당 횟수와 바이트 수를 센다.
+static size_t	g_alloc_count = 0;
+static size_t	g_alloc_bytes = 0;
+
+void* operator new(std::size_t size) BENCH_THROW_BAD_ALLOC
+{
+	++g_alloc_count;
+	g_alloc_bytes += size;
+	void* p = std::malloc(size);
+	if (p == NULL)
+		throw std::bad_alloc();
+	return (p);
+}
+
+void operator delete(void* p) BENCH_NOTHROW
+{
+	std::free(p);
+}
+
+//c++14부터는 크기를 받는 operator delete도 같이 교체해야 한다.
+#if __cplusplus >= 201402L
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+#endif
+
+typedef ft::map<int, int>	ft_map;
+typedef std::map<int, int>	std_map;
+
+template <typename Map, typename Pair>
+void fill(Map& mp, const std::vector<int>& keys)
+{
+	for (size_t i = 0; i < keys.size(); ++i)
+		mp.insert(Pair(keys[i], static_cast<int>(i)));
+}
+
+template <typename Map>
+double run_lower_bound(const Map& mp, const std::vector<int>& queries)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (size_t i = 0; i < queries.size(); ++i)
+	{
+		typename Map::const_iterator it = mp.lower_bound(queries[i]);
+		if (it != mp.end())
+			sum += it->first;
+	}
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+template <typename Map>
+double run_upper_bound(const Map& mp, const std::vector<int>& queries)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (size_t i = 0; i < queries.size(); ++i)
+	{
+		typename Map::const_iterator it = mp.upper_bound(queries[i]);
+		if (it != mp.end())
+			sum += it->first;
+	}
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+template <typename Map>
+double run_equal_range(const Map& mp, const std::vector<int>& queries)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (size_t i = 0; i < queries.size(); ++i)
+	{
+		if (mp.equal_range(queries[i]).first != mp.end())
+			++sum;
+	}
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+void bench_bounds(long n)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	std::vector<int> queries;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next() % (2 * n)));
+	for (long i = 0; i < QUERIES; ++i)
+		queries.push_back(static_cast<int>(rand.next() % (2 * n)));
+
+	ft_map ft_mp;
+	std_map std_mp;
+	fill<ft_map, ft::pair<int, int> >(ft_mp, keys);
+	fill<std_map, std::pair<int, int> >(std_mp, keys);
+
+	bench::report("lower_bound", n, run_lower_bound(ft_mp, queries), run_lower_bound(std_mp, queries));
+	bench::report("upper_bound", n, run_upper_bound(ft_mp, queries), run_upper_bound(std_mp, queries));
+	bench::report("equal_range", n, run_equal_range(ft_mp, queries), run_equal_range(std_mp, queries));
+}
+
+template <typename Map>
+double run_find(const Map& mp, const std::vector<int>& queries)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (size_t i = 0; i < queries.size(); ++i)
+	{
+		typename Map::const_iterator it = mp.find(queries[i]);
+		if (it != mp.end())
+			sum += it->second;
+	}
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+//map<int, int> 원소 하나당 heap 할당 횟수/바이트와 find latency
+void bench_node_layout(long n)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	std::vector<int> queries;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next() % (2 * n)));
+	for (long i = 0; i < QUERIES; ++i)
+		queries.push_back(static_cast<int>(rand.next() % (2 * n)));
+
+	ft_map ft_mp;
+	size_t count = g_alloc_count;
+	size_t bytes = g_alloc_bytes;
+	fill<ft_map, ft::pair<int, int> >(ft_mp, keys);
+	double ft_allocs = static_cast<double>(g_alloc_count - count) / ft_mp.size();
+	double ft_bytes = static_cast<double>(g_alloc_bytes - bytes) / ft_mp.size();
+
+	std_map std_mp;
+	count = g_alloc_count;
+	bytes = g_alloc_bytes;
+	fill<std_map, std::pair<int, int> >(std_mp, keys);
+	double std_allocs = static_cast<double>(g_alloc_count - count) / std_mp.size();
+	double std_bytes = static_cast<double>(g_alloc_bytes - bytes) / std_mp.size();
+
+	std::cout << "memory per element         n=" << std::setw(10) << std::left << n << std::right
+		<< " ft: " << std::setw(6) << ft_allocs << " allocs " << std::setw(7) << ft_bytes << " bytes"
+		<< "   std: " << std::setw(6) << std_allocs << " allocs " << std::setw(7) << std_bytes << " bytes" << std::endl;
+	bench::report("find", n, run_find(ft_mp, queries), run_find(std_mp, queries));
+}
+
+template <typename Map>
+double run_copy(const Map& mp)
+{
+	bench::Timer timer;
+	Map copy(mp);
+	bench::sink(static_cast<long>(copy.size()));
+	return (timer.ms());
+}
+
+//copy constructor (snapshot)
+void bench_copy(long n)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next()));
+
+	ft_map ft_mp;
+	std_map std_mp;
+	fill<ft_map, ft::pair<int, int> >(ft_mp, keys);
+	fill<std_map, std::pair<int, int> >(std_mp, keys);
+
+	bench::report("copy constructor", n, run_copy(ft_mp), run_copy(std_mp));
+}
+
+template <typename Map, typename Pair>
+double run_range_construct(const std::vector<Pair>& values)
+{
+	bench::Timer timer;
+	Map mp(values.begin(), values.end());
+	bench::sink(static_cast<long>(mp.size()));
+	return (timer.ms());
+}
+
+//range constructor (sorted unique / random input)
+void bench_range_construct(long n)
+{
+	bench::Random rand;
+	std::vector<ft::pair<int, int> > ft_sorted;
+	std::vector<std::pair<int, int> > std_sorted;
+	std::vector<ft::pair<int, int> > ft_random;
+	std::vector<std::pair<int, int> > std_random;
+	for (long i = 0; i < n; ++i)
+	{
+		int key = static_cast<int>(rand.next());
+		ft_sorted.push_back(ft::make_pair(static_cast<int>(i), key));
+		std_sorted.push_back(std::make_pair(static_cast<int>(i), key));
+		ft_random.push_back(ft::make_pair(key, static_cast<int>(i)));
+		std_random.push_back(std::make_pair(key, static_cast<int>(i)));
+	}
+
+	bench::report("range ctor (sorted)", n, run_range_construct<ft_map>(ft_sorted), run_range_construct<std_map>(std_sorted));
+	bench::report("range ctor (random)", n, run_range_construct<ft_map>(ft_random), run_range_construct<std_map>(std_random));
+}
+
+template <typename Tree>
+double run_churn(const std::vector<int>& keys, long rounds)
+{
+	bench::Timer timer;
+	Tree tree;
+	for (size_t i = 0; i < keys.size(); ++i)
+		tree.insert(keys[i]);
+	//앞에서부터 하나씩 지우고 새 key를 넣는다.
+	for (long i = 0; i < rounds; ++i)
+	{
+		tree.erase(tree.find(keys[i % keys.size()]));
+		tree.insert(keys[i % keys.size()]);
+	}
+	bench::sink(static_cast<long>(tree.size()));
+	return (timer.ms());
+}
+
+//RBTree node pool: insert n개 후 erase/insert churn
+void bench_node_pool(long n)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next()));
+
+	typedef ft::RBTree<int> plain_tree;
+	typedef ft::RBTree<int, ft::less<int>, ft::pool_allocator<int> > pool_tree;
+	bench::report("insert/erase churn", n, run_churn<pool_tree>(keys, QUERIES), run_churn<plain_tree>(keys, QUERIES),
+					"pool", "std::allocator");
+}
+
+template <typename Map, typename Pair>
+double run_clear(const std::vector<int>& keys)
+{
+	Map mp;
+	fill<Map, Pair>(mp, keys);
+	bench::Timer timer;
+	mp.clear();
+	bench::sink(static_cast<long>(mp.size()));
+	return (timer.ms());
+}
+
+template <typename Tree>
+double run_tree_clear(const std::vector<int>& keys)
+{
+	Tree tree;
+	for (size_t i = 0; i < keys.size(); ++i)
+		tree.insert(keys[i]);
+	bench::Timer timer;
+	tree.clear();
+	bench::sink(static_cast<long>(tree.size()));
+	return (timer.ms());
+}
+
+//clear: map 전체 해제, pool + trivially destructible이면 chunk만 반환
+void bench_clear(long n)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next()));
+
+	bench::report("map clear", n, run_clear<ft_map, ft::pair<int, int> >(keys), run_clear<std_map, std::pair<int, int> >(keys));
+
+	typedef ft::RBTree<int> plain_tree;
+	typedef ft::RBTree<int, ft::less<int>, ft::pool_allocator<int> > pool_tree;
+	bench::report("RBTree clear", n, run_tree_clear<pool_tree>(keys), run_tree_clear<plain_tree>(keys),
+					"pool", "std::allocator");
+}
+
+template <typename Map>
+double run_string_find(const Map& mp, const std::vector<std::string>& queries)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (size_t i = 0; i < queries.size(); ++i)
+	{
+		//key_type이 아닌 const char*로 조회한다.
+		if (mp.find(queries[i].c_str()) != mp.end())
+			++sum;
+	}
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+//string key: const char*로 find (ft는 transparent comparator, std는 c++98이므로 std::string 임시 객체 생성)
+void bench_string_lookup(long n)
+{
+	bench::Random rand;
+	typedef ft::map<std::string, int, ft::less<void> > ft_string_map;
+	typedef std::map<std::string, int> std_string_map;
+	ft_string_map ft_mp;
+	std_string_map std_mp;
+	char buf[64];
+	for (long i = 0; i < n; ++i)
+	{
+		//SSO를 넘는 길이의 key
+		std::sprintf(buf, "benchmark-string-key-%012lu", rand.next() % (2 * n));
+		ft_mp.insert(ft::make_pair(std::string(buf), static_cast<int>(i)));
+		std_mp.insert(std::make_pair(std::string(buf), static_cast<int>(i)));
+	}
+	std::vector<std::string> queries;
+	for (long i = 0; i < QUERIES; ++i)
+	{
+		std::sprintf(buf, "benchmark-string-key-%012lu", rand.next() % (2 * n));
+		queries.push_back(buf);
+	}
+	size_t count = g_alloc_count;
+	double ft_ms = run_string_find(ft_mp, queries);
+	size_t ft_allocs = g_alloc_count - count;
+	count = g_alloc_count;
+	double std_ms = run_string_find(std_mp, queries);
+	size_t std_allocs = g_alloc_count - count;
+	bench::report("find(const char*)", n, ft_ms, std_ms);
+	std::cout << "allocations during find     n=" << std::setw(10) << std::left << n << std::right
+		<< " ft: " << std::setw(10) << ft_allocs << "   std: " << std::setw(10) << std_allocs << std::endl;
+}
+
+template <typename Map>
+double run_begin(const Map& mp)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (long i = 0; i < QUERIES; ++i)
+		sum += mp.begin()->first + mp.rbegin()->first;
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+//가장 작은 원소를 꺼내고 새 원소를 넣는 priority queue 형태의 사용
+template <typename Map, typename Pair>
+double run_pop_min(Map& mp, const std::vector<int>& keys)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (long i = 0; i < QUERIES; ++i)
+	{
+		typename Map::iterator it = mp.begin();
+		sum += it->first;
+		mp.erase(it);
+		mp.insert(Pair(keys[i % keys.size()] + static_cast<int>(i), 0));
+	}
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+//begin/rbegin 반복 호출, pop-min
+void bench_begin(long n)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next() % (2 * n)));
+
+	ft_map ft_mp;
+	std_map std_mp;
+	fill<ft_map, ft::pair<int, int> >(ft_mp, keys);
+	fill<std_map, std::pair<int, int> >(std_mp, keys);
+
+	bench::report("begin + rbegin", n, run_begin(ft_mp), run_begin(std_mp));
+	bench::report("pop min + insert", n, run_pop_min<ft_map, ft::pair<int, int> >(ft_mp, keys),
+					run_pop_min<std_map, std::pair<int, int> >(std_mp, keys));
+}
+
+template <typename Map, typename Pair>
+double run_sequential_insert(long n, bool use_hint)
+{
+	bench::Timer timer;
+	Map mp;
+	//timestamp처럼 증가하는 key를 end()를 hint로 삽입한다.
+	for (long i = 0; i < n; ++i)
+	{
+		if (use_hint)
+			mp.insert(mp.end(), Pair(static_cast<int>(i), 0));
+		else
+			mp.insert(Pair(static_cast<int>(i), 0));
+	}
+	bench::sink(static_cast<long>(mp.size()));
+	return (timer.ms());
+}
+
+//증가하는 key 삽입: hint(end) 사용 / 미사용
+void bench_sequential_insert(long n)
+{
+	bench::report("insert (no hint)", n, run_sequential_insert<ft_map, ft::pair<int, int> >(n, false),
+					run_sequential_insert<std_map, std::pair<int, int> >(n, false));
+	bench::report("insert (hint = end)", n, run_sequential_insert<ft_map, ft::pair<int, int> >(n, true),
+					run_sequential_insert<std_map, std::pair<int, int> >(n, true));
+}
+
+typedef ft::map<int, int, ft::less<int>, std::allocator<ft::pair<const int, int> >, true>	ft_order_map;
+
+//k번째 원소: order statistic map의 select / std::map의 iterator 이동
+double run_select(const ft_order_map& mp, const std::vector<int>& positions)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (size_t i = 0; i < positions.size(); ++i)
+		sum += mp.select(positions[i])->first;
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+double run_advance(const std_map& mp, const std::vector<int>& positions)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (size_t i = 0; i < positions.size(); ++i)
+	{
+		std_map::const_iterator it = mp.begin();
+		std::advance(it, positions[i]);
+		sum += it->first;
+	}
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+//key보다 작은 원소 수: order statistic map의 rank / std::map의 lower_bound까지 distance
+double run_rank(const ft_order_map& mp, const std::vector<int>& queries)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (size_t i = 0; i < queries.size(); ++i)
+		sum += static_cast<long>(mp.rank(queries[i]));
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+double run_rank_walk(const std_map& mp, const std::vector<int>& queries)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (size_t i = 0; i < queries.size(); ++i)
+		sum += std::distance(mp.begin(), mp.lower_bound(queries[i]));
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+//order statistic: select/rank, 삽입 비용(기본 ft::map 대비)
+void bench_order_statistic(long n)
+{
+	//std::map은 O(N) 이동이므로 query 수를 줄인다.
+	long queries_count = 10000;
+	bench::Random rand;
+	std::vector<int> keys;
+	std::vector<int> positions;
+	std::vector<int> queries;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next() % (2 * n)));
+
+	bench::Timer timer;
+	ft_map ft_mp;
+	fill<ft_map, ft::pair<int, int> >(ft_mp, keys);
+	double ft_ms = timer.ms();
+	timer.reset();
+	ft_order_map order_mp;
+	fill<ft_order_map, ft::pair<int, int> >(order_mp, keys);
+	double order_ms = timer.ms();
+	std_map std_mp;
+	fill<std_map, std::pair<int, int> >(std_mp, keys);
+
+	for (long i = 0; i < queries_count; ++i)
+	{
+		positions.push_back(static_cast<int>(rand.next() % order_mp.size()));
+		queries.push_back(static_cast<int>(rand.next() % (2 * n)));
+	}
+	//std::map은 query당 O(N)이므로 일부 query만 실행하고 전체 query 수로 환산한다.
+	long std_count = std::max(1L, std::min(queries_count, 10000000L / n));
+	double scale = static_cast<double>(queries_count) / std_count;
+	std::vector<int> std_positions(positions.begin(), positions.begin() + std_count);
+	std::vector<int> std_queries(queries.begin(), queries.begin() + std_count);
+	bench::report("insert", n, order_ms, ft_ms, "order", "ft");
+	bench::report("select(k)", n, run_select(order_mp, positions), run_advance(std_mp, std_positions) * scale, "order", "std");
+	bench::report("rank(key)", n, run_rank(order_mp, queries), run_rank_walk(std_mp, std_queries) * scale, "order", "std");
+}
+
+typedef ft::map<int, int, ft::less<int>, std::allocator<ft::pair<const int, int> >, false, true>	ft_threaded_map;
+
+//전체 범위를 rounds번 순회한다.
+template <typename Map>
+double run_scan(const Map& mp, long rounds)
+{
+	bench::Timer timer;
+	long sum = 0;
+	for (long r = 0; r < rounds; ++r)
+	{
+		for (typename Map::const_iterator it = mp.begin(); it != mp.end(); ++it)
+			sum += it->second;
+	}
+	bench::sink(sum);
+	return (timer.ms());
+}
+
+//full scan: random 순서로 삽입해 노드가 흩어진 상태에서 begin -> end 순회 (10M 원소 분량)
+void bench_scan(long n)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next()));
+	long rounds = std::max(1L, 10000000L / n);
+
+	ft_threaded_map threaded_mp;
+	std_map std_mp;
+	fill<ft_threaded_map, ft::pair<int, int> >(threaded_mp, keys);
+	fill<std_map, std::pair<int, int> >(std_mp, keys);
+	double threaded_ms = run_scan(threaded_mp, rounds);
+	double std_ms = run_scan(std_mp, rounds);
+	threaded_mp.clear();
+
+	ft_map ft_mp;
+	fill<ft_map, ft::pair<int, int> >(ft_mp, keys);
+	bench::report("scan (threaded)", n, threaded_ms, std_ms, "threaded", "std");
+	bench::report("scan (default)", n, run_scan(ft_mp, rounds), std_ms, "ft", "std");
+}
+
+typedef ft::btree_map<int, int>	ft_btree_map;
+
+//B-tree(노드당 여러 원소)와 RBTree(원소당 노드 하나) 비교: 메모리, find/lower_bound (1M queries), 순회 (10M 원소 분량)
+void bench_btree(long n)
+{
+	bench::Random rand;
+	std::vector<int> keys;
+	std::vector<int> queries;
+	for (long i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rand.next() % (2 * n)));
+	for (long i = 0; i < QUERIES; ++i)
+		queries.push_back(static_cast<int>(rand.next() % (2 * n)));
+	long rounds = std::max(1L, 10000000L / n);
+
+	ft_btree_map btree_mp;
+	size_t count = g_alloc_count;
+	size_t bytes = g_alloc_bytes;
+	fill<ft_btree_map, ft::pair<int, int> >(btree_mp, keys);
+	double btree_allocs = static_cast<double>(g_alloc_count - count) / btree_mp.size();
+	double btree_bytes = static_cast<double>(g_alloc_bytes - bytes) / btree_mp.size();
+
+	ft_map ft_mp;
+	count = g_alloc_count;
+	bytes = g_alloc_bytes;
+	fill<ft_map, ft::pair<int, int> >(ft_mp, keys);
+	double ft_allocs = static_cast<double>(g_alloc_count - count) / ft_mp.size();
+	double ft_bytes = static_cast<double>(g_alloc_bytes - bytes) / ft_mp.size();
+
+	std::cout << "memory per element         n=" << std::setw(10) << std::left << n << std::right
+		<< " btree: " << std::setw(6) << btree_allocs << " allocs " << std::setw(7) << btree_bytes << " bytes"
+		<< "   rbtree: " << std::setw(6) << ft_allocs << " allocs " << std::setw(7) << ft_bytes << " bytes" << std::endl;
+	bench::report("find", n, run_find(btree_mp, queries), run_find(ft_mp, queries), "btree", "rbtree");
+	bench::report("lower_bound", n, run_lower_bound(btree_mp, queries), run_lower_bound(ft_mp, queries), "btree", "rbtree");
+	bench::report("scan", n, run_scan(btree_mp, rounds), run_scan(ft_mp, rounds), "btree", "rbtree");
+}
+
+typedef ft::flat_map<int, int>	ft_flat_map;
+
+template <typename Map>
+double run_batch_insert(Map& mp, const std::vector<ft::pair<int, int> >& values)
+{
+	bench::Timer timer;
+	mp.insert(values.begin(), values.end());
+	bench::sink(static_cast<long>(mp.size()));
+	return (timer.ms());
+}
+
+//flat_map(정렬된 ft::vector) vs ft::map: random 입력으로 생성, n / 10개 batch insert, 조회, 순회
+void bench_flat(long n)
+{
+	bench::Random rand;
+	std::vector<ft::pair<int, int> > values;
+	std::vector<ft::pair<int, int> > batch;
+	std::vector<int> queries;
+	for (long i = 0; i < n; ++i)
+		values.push_back(ft::make_pair(static_cast<int>(rand.next() % (2 * n)), static_cast<int>(i)));
+	for (long i = 0; i < n / 10; ++i)
+		batch.push_back(ft::make_pair(static_cast<int>(rand.next() % (2 * n)), static_cast<int>(i)));
+	for (long i = 0; i < QUERIES; ++i)
+		queries.push_back(static_cast<int>(rand.next() % (2 * n)));
+	long rounds = std::max(1L, 10000000L / n);
+
+	bench::report("build (random)", n, run_range_construct<ft_flat_map>(values), run_range_construct<ft_map>(values), "flat", "rbtree");
+	ft_flat_map flat_mp(values.begin(), values.end());
+	ft_map ft_mp(values.begin(), values.end());
+	bench::report("batch insert (n / 10)", n, run_batch_insert(flat_mp, batch), run_batch_insert(ft_mp, batch), "flat", "rbtree");
+	bench::report("find", n, run_find(flat_mp, queries), run_find(ft_mp, queries), "flat", "rbtree");
+	bench::report("lower_bound", n, run_lower_bound(flat_mp, queries), run_lower_bound(ft_mp, queries), "flat", "rbtree");
+	bench::report("scan", n, run_scan(flat_mp, rounds), run_scan(ft_mp, rounds), "flat", "rbtree");
+}
+
+int main(int argc, char** argv)
+{
+	long max_n = bench::max_elements(argc, argv, 10000000);
+
+	bench::title("lower_bound | upper_bound | equal_range (1M queries)");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_bounds(n);
+
+	bench::title("node layout: memory per element | find (1M queries)");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_node_layout(n);
+
+	bench::title("copy constructor");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_copy(n);
+
+	bench::title("range constructor");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_range_construct(n);
+
+	bench::title("node pool: insert/erase churn (1M rounds)");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_node_pool(n);
+
+	bench::title("clear");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_clear(n);
+
+	bench::title("string key lookup (1M queries)");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_string_lookup(n);
+
+	bench::title("begin/rbegin (1M calls) | pop min (1M rounds)");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_begin(n);
+
+	bench::title("sequential key insert");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_sequential_insert(n);
+
+	//map 세 개를 동시에 만들기 때문에 max_elements / 10 까지만 측정한다.
+	bench::title("order statistic (10K queries, std estimated from a subset)");
+	for (long n = 1000; n <= max_n / 10; n *= 100)
+		bench_order_statistic(n);
+
+	bench::title("full scan (10M elements visited)");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_scan(n);
+
+	bench::title("b-tree vs red-black tree: memory | find, lower_bound (1M queries) | scan (10M elements visited)");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_btree(n);
+
+	bench::title("flat_map vs red-black tree: build | batch insert | find, lower_bound (1M queries) | scan (10M elements visited)");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_flat(n);
+	return (0);
+}
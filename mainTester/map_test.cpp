@@ -1,8 +1,14 @@
 #include "map.hpp"
+#include "btree_map.hpp"
+#include "flat_map.hpp"
+#include "unordered_map.hpp"
 #include <iostream>
 #include <string>
 #include <list>
 #include <map>
+#include <new>
+#include <cstdlib>
+#include <stdexcept>
 
 #ifndef TESTED_NAMESPACE
 #define TESTED_NAMESPACE ft
@@ -13,6 +19,152 @@
 #define T3 TESTED_NAMESPACE::map<T1, T2>::value_type
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::map<T1, T2>::size_type
 
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+# pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+//insert 시 heap 할당 횟수를 세기 위해 operator new를 교체한다.
+static size_t g_alloc_count = 0;
+
+#if __cplusplus >= 201103L
+void* operator new(std::size_t size)
+#else
+void* operator new(std::size_t size) throw(std::bad_alloc)
+#endif
+{
+	++g_alloc_count;
+	void* p = std::malloc(size);
+	if (p == NULL)
+		throw std::bad_alloc();
+	return (p);
+}
+
+#if __cplusplus >= 201103L
+void operator delete(void* p) noexcept
+#else
+void operator delete(void* p) throw()
+#endif
+{
+	std::free(p);
+}
+
+//c++14부터는 크기를 받는 operator delete도 같이 교체해야 한다.
+#if __cplusplus >= 201402L
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+#endif
+
+//value가 몇 번 복사되는지 세는 mapped_type
+struct CopyCounter
+{
+	static size_t copies;
+	CopyCounter() {}
+	CopyCounter(const CopyCounter&) { ++copies; }
+	CopyCounter& operator=(const CopyCounter&) { ++copies; return (*this); }
+};
+size_t CopyCounter::copies = 0;
+
+//기본 생성 횟수를 세는 mapped_type
+struct DefaultCounter
+{
+	static size_t constructions;
+	DefaultCounter() { ++constructions; }
+};
+size_t DefaultCounter::constructions = 0;
+
+//정해진 횟수만큼 복사되면 예외를 던지는 mapped_type (0이면 던지지 않는다)
+struct ThrowOnCopy
+{
+	static size_t copies_until_throw;
+	int value;
+	ThrowOnCopy(int v = 0) : value(v) {}
+	ThrowOnCopy(const ThrowOnCopy& other) : value(other.value)
+	{
+		if (copies_until_throw > 0 && --copies_until_throw == 0)
+			throw std::runtime_error("ThrowOnCopy");
+	}
+	ThrowOnCopy& operator=(const ThrowOnCopy& other) { value = other.value; return (*this); }
+};
+size_t ThrowOnCopy::copies_until_throw = 0;
+
+#if __cplusplus >= 201103L
+//복사도 move도 할 수 없는 mapped_type -> try_emplace는 노드 안에서 바로 생성해야 한다.
+struct NoMove
+{
+	int value;
+	NoMove(int v = 0) : value(v) {}
+	NoMove(int a, int b) : value(a * b) {}
+	NoMove(const NoMove&) = delete;
+	NoMove(NoMove&&) = delete;
+};
+
+//swap 때 옮겨지지 않는(propagate_on_container_swap이 false) allocator -> id로 어느 쪽 것인지 확인한다.
+template <typename T>
+struct TaggedAllocator : public std::allocator<T>
+{
+	typedef std::false_type propagate_on_container_swap;
+
+	template <typename U>
+	struct rebind
+	{
+		typedef TaggedAllocator<U> other;
+	};
+
+	int id;
+
+	TaggedAllocator(int i = 0) : id(i) {}
+	template <typename U>
+	TaggedAllocator(const TaggedAllocator<U>& other) : id(other.id) {}
+
+	//id는 표시용일 뿐이므로 서로 바꾸지 않아도 되도록 항상 같다고 본다.
+	template <typename U>
+	bool operator==(const TaggedAllocator<U>&) const { return (true); }
+	template <typename U>
+	bool operator!=(const TaggedAllocator<U>&) const { return (false); }
+};
+#endif
+
+//std::string과 const char*를 직접 비교하는 transparent comparator
+struct StringLess
+{
+	typedef void is_transparent;
+	bool operator()(const std::string& lhs, const std::string& rhs) const { return (lhs < rhs); }
+	bool operator()(const std::string& lhs, const char* rhs) const { return (lhs.compare(rhs) < 0); }
+	bool operator()(const char* lhs, const std::string& rhs) const { return (rhs.compare(lhs) > 0); }
+};
+
+//allocate/deallocate 호출을 세는 allocator
+static long g_live_allocations = 0;
+
+template <typename T>
+struct CountingAllocator : public std::allocator<T>
+{
+	template <typename U>
+	struct rebind
+	{
+		typedef CountingAllocator<U> other;
+	};
+
+	CountingAllocator() throw() {}
+	CountingAllocator(const CountingAllocator& other) throw() : std::allocator<T>(other) {}
+	template <typename U>
+	CountingAllocator(const CountingAllocator<U>&) throw() {}
+
+	T* allocate(std::size_t n, const void* = 0)
+	{
+		++g_live_allocations;
+		return (std::allocator<T>::allocate(n));
+	}
+
+	void deallocate(T* p, std::size_t n)
+	{
+		--g_live_allocations;
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
 template <typename T>
 void printContainers(T const &mp, bool print_content = true) {
 	const T_SIZE_TYPE size = mp.size();
@@ -28,6 +180,79 @@ void printContainers(T const &mp, bool print_content = true) {
 	std::cout << "------------------------" << std::endl;
 }
 
+//모든 키를 같은 hash로 보내 하나의 probe 순서에 모으는 hasher
+struct CollidingHash
+{
+	size_t operator()(int) const { return (42); }
+};
+
+//(i * step) % mod 키를 차례로 넣고 erase_every번마다 (i * erase_step) % mod 키를 지워 두 container를 같은 상태로 만든다.
+template <typename Cont, typename Ref>
+void fillWithMap(Cont& cont, Ref& ref, int count, int step, int mod, int erase_every, int erase_step)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		int key = (i * step) % mod;
+		cont.insert(typename Cont::value_type(key, i));
+		ref.insert(typename Ref::value_type(key, i));
+		if (i % erase_every == 0)
+		{
+			cont.erase((i * erase_step) % mod);
+			ref.erase((i * erase_step) % mod);
+		}
+	}
+}
+
+//정렬된 ft 전용 container를 앞뒤로 순회한 결과가 TESTED_NAMESPACE map과 같은지 반환한다.
+template <typename Cont, typename Ref>
+bool sameOrder(const Cont& cont, const Ref& ref)
+{
+	typename Cont::const_iterator it = cont.begin();
+	for (typename Ref::const_iterator r = ref.begin(); r != ref.end(); ++r, ++it)
+		if (it == cont.end() || it->first != r->first || it->second != r->second)
+			return (false);
+	if (it != cont.end())
+		return (false);
+	typename Cont::const_reverse_iterator rit = cont.rbegin();
+	for (typename Ref::const_reverse_iterator r = ref.rbegin(); r != ref.rend(); ++r, ++rit)
+		if (rit == cont.rend() || rit->first != r->first)
+			return (false);
+	return (rit == cont.rend());
+}
+
+//정렬된 ft 전용 container를 TESTED_NAMESPACE map과 비교해 size, 순회, [first, last] 키의 bound/count 결과를 출력한다.
+template <typename Cont, typename Ref>
+void compareWithMap(const Cont& cont, const Ref& ref, int first, int last)
+{
+	bool bound_ok = true;
+	for (int key = first; key <= last; ++key)
+	{
+		typename Cont::const_iterator lower = cont.lower_bound(key);
+		typename Cont::const_iterator upper = cont.upper_bound(key);
+		typename Ref::const_iterator ref_lower = ref.lower_bound(key);
+		typename Ref::const_iterator ref_upper = ref.upper_bound(key);
+		bound_ok = bound_ok && (lower == cont.end()) == (ref_lower == ref.end()) && (lower == cont.end() || lower->first == ref_lower->first)
+			&& (upper == cont.end()) == (ref_upper == ref.end()) && (upper == cont.end() || upper->first == ref_upper->first)
+			&& cont.count(key) == ref.count(key);
+	}
+	std::cout << "size: " << cont.size() << " / " << ref.size() << std::endl;
+	std::cout << "order: " << (sameOrder(cont, ref) ? "OK" : "KO") << ", bounds: " << (bound_ok ? "OK" : "KO") << std::endl;
+}
+
+//ft::unordered_map은 순서가 없으므로 [first, last] 키의 원소와, 순회가 모든 원소를 한 번씩 지나는지만 비교한다.
+template <typename K, typename V, typename H, typename E, typename A, typename Ref>
+void compareWithMap(const ft::unordered_map<K, V, H, E, A>& cont, const Ref& ref, int first, int last)
+{
+	bool element_ok = true;
+	for (int key = first; key <= last; ++key)
+		element_ok = element_ok && cont.count(key) == ref.count(key) && (!ref.count(key) || cont.at(key) == ref.find(key)->second);
+	size_t visited = 0;
+	for (typename ft::unordered_map<K, V, H, E, A>::const_iterator it = cont.begin(); it != cont.end(); ++it)
+		visited += ref.count(it->first);
+	std::cout << "size: " << cont.size() << " / " << ref.size() << std::endl;
+	std::cout << "elements: " << (element_ok ? "OK" : "KO") << ", iteration: " << (visited == ref.size() ? "OK" : "KO") << std::endl;
+}
+
 int main() {
 	std::cout << "################ Test Map ################" << std::endl;
 	std::cout << "===== default | range | copy constructor =====" << std::endl;
@@ -48,6 +273,13 @@ int main() {
 	TESTED_NAMESPACE::map<T1, T2> mp_copy(mp_range);
 	printContainers(mp_copy);
 
+	std::cout << "range constructor (unsorted, duplicated keys): " << std::endl;
+	std::list<T3> lst_unsorted;
+	for (unsigned int i = 0; i < lst_size; ++i)
+		lst_unsorted.push_back(T3(i < 4 ? i : (i * 7) % 5, std::string(i + 1, i + 97)));
+	TESTED_NAMESPACE::map<T1, T2> mp_unsorted(lst_unsorted.begin(), lst_unsorted.end());
+	printContainers(mp_unsorted);
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== assignment operator =====" << std::endl;
 	lst_size = 5;
@@ -148,4 +380,461 @@ int main() {
 	std::cout << "operator<=: " << ((lhs <= rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>:  " << ((lhs > rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>=: " << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== insert allocations | copies =====" << std::endl;
+	TESTED_NAMESPACE::map<T1, CopyCounter> mp_count;
+	//c++11 std::map은 const가 아닌 lvalue를 template insert(P&&)로 받아 노드를 먼저 만들므로 const로 넘긴다.
+	const TESTED_NAMESPACE::map<T1, CopyCounter>::value_type counted(1, CopyCounter());
+	for (int i = 0; i < 3; ++i)
+	{
+		size_t allocs = g_alloc_count;
+		CopyCounter::copies = 0;
+		mp_count.insert(counted);
+		std::cout << "insert key 1 (" << (i == 0 ? "new" : "duplicate") << "): "
+			<< g_alloc_count - allocs << " allocation(s), " << CopyCounter::copies << " copy(ies)" << std::endl;
+	}
+	const TESTED_NAMESPACE::map<T1, CopyCounter>::value_type counted2(2, CopyCounter());
+	size_t allocs = g_alloc_count;
+	CopyCounter::copies = 0;
+	mp_count.insert(counted2);
+#ifdef BTREE_TEST
+	//ft::btree는 노드 하나에 여러 원소를 담으므로 새 key라도 할당하지 않을 수 있다. -> 상한만 확인한다.
+	std::cout << "insert key 2 (new): " << (g_alloc_count - allocs <= 1 ? "<= 1" : "> 1") << " allocation(s), " << CopyCounter::copies << " copy(ies)" << std::endl;
+#else
+	std::cout << "insert key 2 (new): " << g_alloc_count - allocs << " allocation(s), " << CopyCounter::copies << " copy(ies)" << std::endl;
+#endif
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== allocator =====" << std::endl;
+	{
+		typedef TESTED_NAMESPACE::map<T1, T2, std::less<T1>, CountingAllocator<T3> > counted_map;
+		counted_map mp_alloc;
+		for (int i = 0; i < 5; ++i)
+			mp_alloc[i] = "alloc";
+#ifdef BTREE_TEST
+		//ft::btree는 원소 5개가 leaf 하나에 들어간다.
+		std::cout << "nodes from allocator: " << (g_live_allocations > 0 ? "OK" : "KO") << std::endl;
+#else
+		std::cout << "nodes from allocator: " << (g_live_allocations >= 5 ? "OK" : "KO") << std::endl;
+#endif
+		counted_map mp_alloc_copy(mp_alloc);
+		mp_alloc_copy.erase(2);
+		std::cout << "copy size: " << mp_alloc_copy.size() << std::endl;
+	}
+	std::cout << "all released: " << (g_live_allocations == 0 ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== pool allocator =====" << std::endl;
+	{
+		//ft::pool_allocator를 넘긴 map은 노드를 slab pool에서 할당한다. erase로 free list를 재사용하고 swap/copy/clear를 거친다.
+		typedef ft::map<T1, T1, ft::less<T1>, ft::pool_allocator<ft::pair<const T1, T1> > > pool_map;
+		pool_map mp_pool;
+		TESTED_NAMESPACE::map<T1, T1> mp_ref;
+		for (int i = 0; i < 100; ++i)
+		{
+			mp_pool[(i * 7) % 53] = i;
+			mp_ref[(i * 7) % 53] = i;
+			if (i % 4 == 0)
+			{
+				mp_pool.erase((i * 3) % 53);
+				mp_ref.erase((i * 3) % 53);
+			}
+		}
+		pool_map mp_other;
+		mp_other[-1] = -1;
+		mp_other.swap(mp_pool);
+		bool same = mp_other.size() == mp_ref.size();
+		pool_map::iterator it = mp_other.begin();
+		for (TESTED_NAMESPACE::map<T1, T1>::iterator ref = mp_ref.begin(); same && ref != mp_ref.end(); ++ref, ++it)
+			same = it->first == ref->first && it->second == ref->second;
+		std::cout << "after swap: " << (same ? "OK" : "KO") << ", other: " << mp_pool.size() << " " << mp_pool.begin()->first << std::endl;
+		mp_pool = mp_other;
+		mp_other.clear();
+		mp_other[7] = 7;
+		same = mp_pool.size() == mp_ref.size();
+		it = mp_pool.begin();
+		for (TESTED_NAMESPACE::map<T1, T1>::iterator ref = mp_ref.begin(); same && ref != mp_ref.end(); ++ref, ++it)
+			same = it->first == ref->first && it->second == ref->second;
+		std::cout << "after copy | clear: " << (same ? "OK" : "KO") << ", cleared: " << mp_other.size() << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== copy exception safety =====" << std::endl;
+	{
+		//200개 중 151번째 원소를 복사할 때 예외가 나면, 그때까지 복제한 노드를 모두 해제해야 한다.
+		typedef TESTED_NAMESPACE::map<T1, ThrowOnCopy, std::less<T1>,
+			CountingAllocator<TESTED_NAMESPACE::map<T1, ThrowOnCopy>::value_type> > throwing_map;
+		throwing_map mp_src;
+		for (int i = 0; i < 200; ++i)
+			mp_src.insert(throwing_map::value_type(i, ThrowOnCopy(i)));
+		long live = g_live_allocations;
+		ThrowOnCopy::copies_until_throw = 151;
+		bool thrown = false;
+		try
+		{
+			throwing_map mp_copy(mp_src);
+		}
+		catch (const std::runtime_error&)
+		{
+			thrown = true;
+		}
+		ThrowOnCopy::copies_until_throw = 0;
+		std::cout << "copy threw: " << (thrown ? "OK" : "KO") << ", leaked allocations: " << g_live_allocations - live << std::endl;
+		throwing_map mp_assign;
+		mp_assign[-1] = ThrowOnCopy(-1);
+		ThrowOnCopy::copies_until_throw = 151;
+		thrown = false;
+		try
+		{
+			mp_assign = mp_src;
+		}
+		catch (const std::runtime_error&)
+		{
+			thrown = true;
+		}
+		ThrowOnCopy::copies_until_throw = 0;
+		std::cout << "assignment threw: " << (thrown ? "OK" : "KO") << ", source size: " << mp_src.size() << std::endl;
+	}
+	std::cout << "all released: " << (g_live_allocations == 0 ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== lookup by key =====" << std::endl;
+	{
+		TESTED_NAMESPACE::map<T1, DefaultCounter> mp_lookup;
+		for (int i = 0; i < 10; i += 2)
+			mp_lookup.insert(TESTED_NAMESPACE::map<T1, DefaultCounter>::value_type(i, DefaultCounter()));
+		DefaultCounter::constructions = 0;
+		std::cout << "find(4): " << (mp_lookup.find(4) != mp_lookup.end()) << ", find(5): " << (mp_lookup.find(5) != mp_lookup.end()) << std::endl;
+		std::cout << "count(6): " << mp_lookup.count(6) << ", lower_bound(3): " << mp_lookup.lower_bound(3)->first
+			<< ", upper_bound(4): " << mp_lookup.upper_bound(4)->first << std::endl;
+		std::cout << "erase(8): " << mp_lookup.erase(8) << ", erase(9): " << mp_lookup.erase(9) << std::endl;
+		std::cout << "mapped_type constructions: " << DefaultCounter::constructions << std::endl;
+
+		TESTED_NAMESPACE::map<std::string, int, StringLess> mp_str;
+		mp_str["apple"] = 1;
+		mp_str["banana"] = 2;
+		mp_str["cherry"] = 3;
+		std::cout << "find(\"banana\"): " << mp_str.find("banana")->second << ", count(\"kiwi\"): " << mp_str.count("kiwi") << std::endl;
+		std::cout << "lower_bound(\"b\"): " << mp_str.lower_bound("b")->first << ", upper_bound(\"banana\"): " << mp_str.upper_bound("banana")->first << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== order statistic =====" << std::endl;
+	{
+		typedef ft::map<T1, T1, ft::less<T1>, std::allocator<ft::pair<const T1, T1> >, true> order_map;
+		order_map mp_order;
+		TESTED_NAMESPACE::map<T1, T1> mp_ref;
+		std::cout << "empty select(0): " << (mp_order.select(0) == mp_order.end() ? "OK" : "KO")
+			<< ", rank(0): " << mp_order.rank(0) << std::endl;
+		fillWithMap(mp_order, mp_ref, 200, 37, 101, 3, 11);
+		compareWithMap(order_map(mp_order), mp_ref, -1, 102);
+
+		//select(k)는 k번째 원소, rank(k)는 k보다 작은 키의 수(없는 키 포함)여야 한다.
+		bool select_ok = true;
+		bool rank_ok = true;
+		size_t k = 0;
+		for (TESTED_NAMESPACE::map<T1, T1>::iterator it = mp_ref.begin(); it != mp_ref.end(); ++it, ++k)
+			select_ok = select_ok && mp_order.select(k)->first == it->first;
+		for (int key = -1; key < 102; ++key)
+		{
+			size_t less = 0;
+			for (TESTED_NAMESPACE::map<T1, T1>::iterator it = mp_ref.begin(); it != mp_ref.end() && it->first < key; ++it)
+				++less;
+			rank_ok = rank_ok && mp_order.rank(key) == less;
+		}
+		std::cout << "select: " << (select_ok ? "OK" : "KO") << ", rank: " << (rank_ok ? "OK" : "KO") << std::endl;
+		std::cout << "select(0): " << (mp_order.select(0) == mp_order.begin() ? "OK" : "KO")
+			<< ", select(size - 1): " << (mp_order.select(mp_order.size() - 1) == --mp_order.end() ? "OK" : "KO")
+			<< ", select(size): " << (mp_order.select(mp_order.size()) == mp_order.end() ? "OK" : "KO")
+			<< ", select(size + 100): " << (mp_order.select(mp_order.size() + 100) == mp_order.end() ? "OK" : "KO") << std::endl;
+		std::cout << "rank(min): " << mp_order.rank(mp_order.begin()->first)
+			<< ", rank(max + 1): " << (mp_order.rank((--mp_order.end())->first + 1) == mp_order.size() ? "OK" : "KO") << std::endl;
+		//앞/뒤 원소를 지운 뒤에도 select와 rank가 맞아야 한다.
+		mp_order.erase(mp_order.begin());
+		mp_order.erase(--mp_order.end());
+		mp_ref.erase(mp_ref.begin());
+		mp_ref.erase(--mp_ref.end());
+		std::cout << "after erase select(0): " << (mp_order.select(0)->first == mp_ref.begin()->first ? "OK" : "KO")
+			<< ", select(size - 1): " << (mp_order.select(mp_order.size() - 1)->first == (--mp_ref.end())->first ? "OK" : "KO")
+			<< ", rank(max): " << (mp_order.rank((--mp_ref.end())->first) == mp_ref.size() - 1 ? "OK" : "KO") << std::endl;
+		std::cout << "select(10): " << mp_order.select(10)->first << ", rank(50): " << mp_order.rank(50)
+			<< ", distance(select(3), select(40)): " << ft::distance(mp_order.select(3), mp_order.select(40)) << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== threaded iteration =====" << std::endl;
+	{
+		typedef ft::map<T1, T1, ft::less<T1>, std::allocator<ft::pair<const T1, T1> >, false, true> threaded_map;
+		threaded_map mp_thread;
+		TESTED_NAMESPACE::map<T1, T1> mp_ref;
+		fillWithMap(mp_thread, mp_ref, 200, 53, 127, 4, 7);
+		compareWithMap(threaded_map(mp_thread), mp_ref, -1, 128);
+
+		//지운 원소의 앞뒤 원소가 thread로 서로 이어져야 한다. (leaf, 자식이 둘인 노드, root, 처음/마지막 원소를 모두 지운다)
+		bool link_ok = true;
+		bool order_ok = true;
+		for (int i = 0; i < 127 && !mp_ref.empty(); ++i)
+		{
+			threaded_map::iterator it = mp_thread.find((i * 29) % 127);
+			if (it == mp_thread.end())
+				continue ;
+			bool has_prev = (it != mp_thread.begin());
+			threaded_map::iterator prev = it;
+			if (has_prev)
+				--prev;
+			threaded_map::iterator next = it;
+			++next;
+			mp_thread.erase(it);
+			mp_ref.erase((i * 29) % 127);
+			if (has_prev)
+			{
+				threaded_map::iterator after_prev = prev;
+				link_ok = link_ok && ++after_prev == next;
+			}
+			else
+				link_ok = link_ok && mp_thread.begin() == next;
+			if (next != mp_thread.end())
+			{
+				threaded_map::iterator before_next = next;
+				link_ok = link_ok && (has_prev ? --before_next == prev : before_next == mp_thread.begin());
+			}
+			order_ok = order_ok && sameOrder(mp_thread, mp_ref);
+		}
+		std::cout << "prev/next after erase: " << (link_ok ? "OK" : "KO") << ", order: " << (order_ok ? "OK" : "KO")
+			<< ", size: " << mp_thread.size() << " / " << mp_ref.size() << std::endl;
+
+		//threaded 노드도 showTree로 출력할 수 있어야 한다.
+		threaded_map mp_show;
+		for (int i = 1; i <= 5; ++i)
+			mp_show[i * 10] = i;
+		mp_show.showTree();
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== b-tree nodes =====" << std::endl;
+	{
+		//노드당 slot이 3개인 ft::btree_map으로 분할/병합을 여러 단계 일으킨다.
+		typedef ft::btree_map<T1, T1, ft::less<T1>, std::allocator<ft::pair<const T1, T1> >, 0> small_btree;
+		small_btree mp_btree;
+		TESTED_NAMESPACE::map<T1, T1> mp_ref;
+		fillWithMap(mp_btree, mp_ref, 300, 61, 211, 3, 13);
+		mp_btree.erase(mp_btree.lower_bound(40), mp_btree.lower_bound(60));
+		mp_ref.erase(mp_ref.lower_bound(40), mp_ref.lower_bound(60));
+		compareWithMap(small_btree(mp_btree), mp_ref, -1, 212);
+
+		//원소를 하나씩 넣고 지우며 노드가 가득 차 분할되는 순간과 절반 아래로 줄어 병합되는 순간마다 비교한다.
+		bool ascending_ok = true;
+		bool descending_ok = true;
+		bool merge_ok = true;
+		small_btree mp_split;
+		TESTED_NAMESPACE::map<T1, T1> mp_split_ref;
+		for (int i = 0; i < 64; ++i)
+		{
+			mp_split.insert(mp_split.end(), ft::make_pair(i * 2, i));
+			mp_split_ref.insert(TESTED_NAMESPACE::make_pair(i * 2, i));
+			ascending_ok = ascending_ok && sameOrder(mp_split, mp_split_ref);
+		}
+		for (int i = 63; i >= 0; --i)
+		{
+			mp_split.insert(mp_split.begin(), ft::make_pair(i * 2 - 127, i));
+			mp_split_ref.insert(TESTED_NAMESPACE::make_pair(i * 2 - 127, i));
+			descending_ok = descending_ok && sameOrder(mp_split, mp_split_ref);
+		}
+		for (int i = 0; !mp_split_ref.empty(); ++i)
+		{
+			//앞, 가운데, 뒤를 번갈아 지운다.
+			TESTED_NAMESPACE::map<T1, T1>::iterator ref = mp_split_ref.begin();
+			if (i % 3 == 1)
+				ref = mp_split_ref.lower_bound((mp_split_ref.begin()->first + (--mp_split_ref.end())->first) / 2);
+			else if (i % 3 == 2)
+				ref = --mp_split_ref.end();
+			mp_split.erase(ref->first);
+			mp_split_ref.erase(ref);
+			merge_ok = merge_ok && sameOrder(mp_split, mp_split_ref);
+		}
+		std::cout << "split (ascending): " << (ascending_ok ? "OK" : "KO") << ", split (descending): " << (descending_ok ? "OK" : "KO")
+			<< ", merge: " << (merge_ok ? "OK" : "KO") << ", empty: " << (mp_split.begin() == mp_split.end() ? "OK" : "KO") << std::endl;
+#if __cplusplus >= 201103L
+		//swap은 노드 pointer만 바꾸고, propagate하지 않는 allocator는 그대로 둔다.
+		typedef TaggedAllocator<ft::pair<const T1, T1> > tagged_alloc;
+		ft::btree_map<T1, T1, ft::less<T1>, tagged_alloc, 0> mp_left(ft::less<T1>(), tagged_alloc(1));
+		ft::btree_map<T1, T1, ft::less<T1>, tagged_alloc, 0> mp_right(ft::less<T1>(), tagged_alloc(2));
+		for (int i = 0; i < 20; ++i)
+			mp_left[i] = i;
+		mp_right[100] = 100;
+		const T1* first_left = &mp_left.begin()->second;
+		mp_left.swap(mp_right);
+		std::cout << "swap: " << mp_left.size() << " / " << mp_right.size()
+			<< ", nodes kept: " << (&mp_right.begin()->second == first_left ? "OK" : "KO")
+			<< ", allocator: " << mp_left.get_allocator().id << " / " << mp_right.get_allocator().id << std::endl;
+#endif
+	}
+
+	std::cout << "===== flat map =====" << std::endl;
+	{
+		//정렬되지 않고 중복이 있는 입력으로 ft::flat_map을 만들고 batch insert한다.
+		std::list<ft::pair<T1, T1> > lst;
+		std::list<TESTED_NAMESPACE::pair<T1, T1> > lst_ref;
+		for (int i = 0; i < 200; ++i)
+		{
+			lst.push_back(ft::make_pair((i * 37) % 101, i));
+			lst_ref.push_back(TESTED_NAMESPACE::make_pair((i * 37) % 101, i));
+		}
+		ft::flat_map<T1, T1> mp_flat(lst.begin(), lst.end());
+		TESTED_NAMESPACE::map<T1, T1> mp_ref(lst_ref.begin(), lst_ref.end());
+		lst.clear();
+		lst_ref.clear();
+		for (int i = 0; i < 100; ++i)
+		{
+			lst.push_back(ft::make_pair((i * 53) % 211, -i));
+			lst_ref.push_back(TESTED_NAMESPACE::make_pair((i * 53) % 211, -i));
+		}
+		mp_flat.insert(lst.begin(), lst.end());
+		mp_ref.insert(lst_ref.begin(), lst_ref.end());
+		ft::flat_map<T1, T1> mp_copy;
+		mp_copy = mp_flat;
+		compareWithMap(mp_copy, mp_ref, -1, 212);
+
+		//가운데 삽입: 맞는 hint, 틀린 hint, hint 없음 모두 정렬된 자리에 들어가고 그 원소를 반환해야 한다.
+		ft::flat_map<T1, T1> mp_mid;
+		for (int i = 0; i < 10; ++i)
+			mp_mid[i * 10] = i;
+		ft::flat_map<T1, T1>::iterator it = mp_mid.insert(mp_mid.lower_bound(45), ft::make_pair(45, 1));
+		std::cout << "insert(hint, 45): " << it->first << " at " << (it - mp_mid.begin());
+		it = mp_mid.insert(mp_mid.begin(), ft::make_pair(55, 2));
+		std::cout << ", insert(begin, 55): " << it->first << " at " << (it - mp_mid.begin());
+		it = mp_mid.insert(mp_mid.end(), ft::make_pair(15, 3));
+		std::cout << ", insert(end, 15): " << it->first << " at " << (it - mp_mid.begin()) << std::endl;
+		ft::pair<ft::flat_map<T1, T1>::iterator, bool> res = mp_mid.insert(ft::make_pair(50, 4));
+		std::cout << "insert(50) existing: " << res.first->first << " " << res.first->second << " " << res.second;
+		res = mp_mid.insert(ft::make_pair(51, 5));
+		std::cout << ", insert(51): " << res.first->first << " at " << (res.first - mp_mid.begin()) << " " << res.second << std::endl;
+		//이미 있는 키와 섞인 range도 가운데에 끼워 넣는다.
+		lst.clear();
+		for (int i = 41; i < 50; i += 2)
+			lst.push_back(ft::make_pair(i, i));
+		lst.push_back(ft::make_pair(40, -1));
+		mp_mid.insert(lst.begin(), lst.end());
+		std::cout << "range into middle:";
+		for (ft::flat_map<T1, T1>::const_iterator cit = mp_mid.begin(); cit != mp_mid.end(); ++cit)
+			std::cout << " " << cit->first;
+		std::cout << std::endl;
+		std::cout << "[40]: " << mp_mid[40] << ", size: " << mp_mid.size() << std::endl;
+	}
+
+	std::cout << "===== unordered map =====" << std::endl;
+	{
+		ft::unordered_map<T1, T1> mp_hash;
+		TESTED_NAMESPACE::map<T1, T1> mp_ref;
+		fillWithMap(mp_hash, mp_ref, 500, 37, 211, 3, 13);
+		ft::unordered_map<T1, T1> mp_copy;
+		mp_copy = mp_hash;
+		compareWithMap(mp_copy, mp_ref, -1, 212);
+
+		//rehash로 slot 수를 늘리고 줄여도 원소는 그대로여야 한다.
+		mp_copy.rehash(1000);
+		std::cout << "rehash(1000): " << (mp_copy.bucket_count() >= 1000 ? "OK" : "KO") << std::endl;
+		compareWithMap(mp_copy, mp_ref, -1, 212);
+		mp_copy.rehash(0);
+		std::cout << "rehash(0): " << (mp_copy.bucket_count() < 1000 ? "OK" : "KO")
+			<< ", load factor: " << (mp_copy.load_factor() <= mp_copy.max_load_factor() ? "OK" : "KO") << std::endl;
+		compareWithMap(mp_copy, mp_ref, -1, 212);
+
+		//모든 키가 같은 hash를 가지면 하나의 probe 순서에 이어진다.
+		//중간을 지워도 그 뒤의 키를 찾을 수 있어야 하고, 지운 자리에 다시 넣을 수 있어야 한다.
+		ft::unordered_map<T1, T1, CollidingHash> mp_probe;
+		TESTED_NAMESPACE::map<T1, T1> mp_probe_ref;
+		for (int i = 0; i < 40; ++i)
+		{
+			mp_probe[i] = i;
+			mp_probe_ref[i] = i;
+		}
+		for (int i = 0; i < 40; i += 3)
+		{
+			mp_probe.erase(i);
+			mp_probe_ref.erase(i);
+		}
+		std::cout << "erase in probe chain:" << std::endl;
+		compareWithMap(mp_probe, mp_probe_ref, -1, 41);
+		for (int i = 0; i < 40; i += 6)
+		{
+			mp_probe[i] = -i;
+			mp_probe_ref[i] = -i;
+		}
+		std::cout << "reinsert into erased slots:" << std::endl;
+		compareWithMap(mp_probe, mp_probe_ref, -1, 41);
+		//순회하면서 지운다. 원소를 옮기지 않으므로 erase(it++)가 가능하다.
+		for (ft::unordered_map<T1, T1, CollidingHash>::iterator it = mp_probe.begin(); it != mp_probe.end(); )
+		{
+			if (it->first % 2 == 0)
+			{
+				mp_probe_ref.erase(it->first);
+				mp_probe.erase(it++);
+			}
+			else
+				++it;
+		}
+		std::cout << "erase while iterating:" << std::endl;
+		compareWithMap(mp_probe, mp_probe_ref, -1, 41);
+	}
+
+#if __cplusplus >= 201103L
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== move | emplace | try_emplace (c++11) =====" << std::endl;
+	{
+		TESTED_NAMESPACE::map<T1, T2> mp_move;
+		std::cout << "emplace(1): " << mp_move.emplace(1, "one").second << std::endl;
+		std::cout << "emplace(1) again: " << mp_move.emplace(1, "uno").second << std::endl;
+		std::cout << "emplace_hint(2): " << mp_move.emplace_hint(mp_move.end(), 2, "two")->second << std::endl;
+#if __cplusplus >= 201703L
+		//std::map::try_emplace는 c++17 (make cxx11_test CXX11_STD=c++17)
+		std::string value("three");
+		std::cout << "try_emplace(3): " << mp_move.try_emplace(3, std::move(value)).second << std::endl;
+		std::string kept("kept");
+		std::cout << "try_emplace(3) again: " << mp_move.try_emplace(3, std::move(kept)).second << ", argument: " << kept << std::endl;
+		std::cout << "try_emplace(4, 2, 'x'): " << mp_move.try_emplace(4, 2, 'x').first->second << std::endl;
+		//move할 수 없는 mapped_type은 원소를 옮기지 않는 노드 기반 ft::map만 담을 수 있다. (b-tree/flat은 원소를 옮긴다)
+		ft::map<T1, NoMove> mp_nomove;
+		std::cout << "try_emplace(1, 5) non-movable: " << mp_nomove.try_emplace(1, 5).first->second.value << std::endl;
+		std::cout << "try_emplace(1, 6) again: " << mp_nomove.try_emplace(1, 6).second << ", value: " << mp_nomove.find(1)->second.value << std::endl;
+		int key = 2;
+		std::cout << "try_emplace(key, 3, 4): " << mp_nomove.try_emplace(key, 3, 4).first->second.value << std::endl;
+		std::cout << "try_emplace(3) default: " << mp_nomove.try_emplace(3).first->second.value << std::endl;
+#endif
+		mp_move.insert(T3(5, "five"));
+		printContainers(mp_move);
+		TESTED_NAMESPACE::map<T1, T2> mp_moved(std::move(mp_move));
+		std::cout << "after move constructor: " << mp_move.size() << " " << mp_moved.size() << std::endl;
+		mp_move = std::move(mp_moved);
+		std::cout << "after move assignment: " << mp_move.size() << " " << mp_moved.size() << std::endl;
+		printContainers(mp_move);
+	}
+	{
+		//ft::flat_map도 같은 c++11 interface를 가진다. 같은 연산을 한 TESTED_NAMESPACE map과 비교한다.
+		ft::flat_map<T1, T2> mp_flat;
+		TESTED_NAMESPACE::map<T1, T2> mp_ref;
+		std::cout << "flat emplace(3): " << mp_flat.emplace(3, "three").second << ", again: " << mp_flat.emplace(3, "tres").second << std::endl;
+		mp_ref.emplace(3, "three");
+		std::cout << "flat emplace_hint(9): " << mp_flat.emplace_hint(mp_flat.end(), 9, "nine")->second << std::endl;
+		mp_ref.emplace_hint(mp_ref.end(), 9, "nine");
+		mp_flat.insert(ft::flat_map<T1, T2>::value_type(1, "one"));
+		mp_ref.insert(T3(1, "one"));
+#if __cplusplus >= 201703L
+		std::string kept("kept");
+		std::cout << "flat try_emplace(5, 3, 'y'): " << mp_flat.try_emplace(5, 3, 'y').first->second
+			<< ", again: " << mp_flat.try_emplace(5, std::move(kept)).second << ", argument: " << kept << std::endl;
+		mp_ref.try_emplace(5, 3, 'y');
+#endif
+		ft::flat_map<T1, T2> mp_moved(std::move(mp_flat));
+		std::cout << "flat after move constructor: " << mp_flat.size() << " " << mp_moved.size() << std::endl;
+		mp_flat = std::move(mp_moved);
+		std::cout << "flat after move assignment: " << mp_flat.size() << " " << mp_moved.size() << std::endl;
+		bool same = mp_flat.size() == mp_ref.size();
+		ft::flat_map<T1, T2>::iterator it = mp_flat.begin();
+		for (TESTED_NAMESPACE::map<T1, T2>::iterator ref = mp_ref.begin(); same && ref != mp_ref.end(); ++ref, ++it)
+			same = it->first == ref->first && it->second == ref->second;
+		std::cout << "flat elements: " << (same ? "OK" : "KO") << std::endl;
+	}
+#endif
 }
@@ -0,0 +1,199 @@
+#include "vector.hpp"
+#include "map.hpp"
+#include "bench.hpp"
+#include <vector>
+#include <map>
+#include <string>
+#include <algorithm>
+#include <cstdio>
+
+/**
+ * move benchmark
+ * usage: ./move_bench [max_elements]
+ * std::string(짧은 문자열 최적화를 넘는 40자) payload로 ft와 std를 비교한다.
+ * c++98(복사)과 c++11(move)을 비교하려면 CXXSTD를 바꿔 두 번 실행한다.
+ * make bench_unit CONT=move_bench CXXSTD=c++98 / CXXSTD=c++11
+ */
+
+typedef ft::vector<std::string>				ft_str_vector;
+typedef std::vector<std::string>			std_str_vector;
+typedef ft::vector<ft::vector<int> >		ft_nested_vector;
+typedef std::vector<std::vector<int> >		std_nested_vector;
+typedef ft::map<int, std::string>			ft_str_map;
+typedef std::map<int, std::string>			std_str_map;
+
+static std::vector<std::string> make_strings(long n)
+{
+	bench::Random rand;
+	std::vector<std::string> strs;
+	char buf[64];
+	for (long i = 0; i < n; ++i)
+	{
+		std::sprintf(buf, "benchmark-string-payload-%014lu", rand.next());
+		strs.push_back(buf);
+	}
+	return (strs);
+}
+
+//재할당 때마다 원소를 옮긴다. c++98은 문자열 복사, c++11은 move
+template <typename Vector>
+double run_push_back(const std::vector<std::string>& strs)
+{
+	bench::Timer timer;
+	Vector v;
+	for (size_t i = 0; i < strs.size(); ++i)
+		v.push_back(strs[i]);
+	bench::sink(static_cast<long>(v.size()));
+	return (timer.ms());
+}
+
+//임시 문자열을 넘긴다. c++11에서는 push_back(T&&)로 move된다.
+template <typename Vector>
+double run_push_back_temporary(const std::vector<std::string>& strs)
+{
+	bench::Timer timer;
+	Vector v;
+	for (size_t i = 0; i < strs.size(); ++i)
+		v.push_back(std::string(strs[i]));
+	bench::sink(static_cast<long>(v.size()));
+	return (timer.ms());
+}
+
+//앞쪽에 rounds번 삽입한다. 뒤의 원소를 모두 한 칸씩 옮긴다.
+template <typename Vector>
+double run_insert_front(const std::vector<std::string>& strs, long rounds)
+{
+	Vector v(strs.begin(), strs.end());
+	bench::Timer timer;
+	for (long i = 0; i < rounds; ++i)
+		v.insert(v.begin(), strs[i % strs.size()]);
+	bench::sink(static_cast<long>(v.size()));
+	return (timer.ms());
+}
+
+//원소가 vector<int>인 vector. 재할당 때 c++98은 안쪽 vector를 통째로 복사한다.
+template <typename Vector, typename Inner>
+double run_nested_push_back(long n)
+{
+	bench::Timer timer;
+	Vector v;
+	Inner inner(16, 1);
+	for (long i = 0; i < n; ++i)
+		v.push_back(inner);
+	bench::sink(static_cast<long>(v.size()));
+	return (timer.ms());
+}
+
+void bench_vector(long n)
+{
+	std::vector<std::string> strs = make_strings(n);
+	long rounds = std::max(1L, std::min(1000L, 100000000L / n));
+
+	bench::report("push_back(const&)", n, run_push_back<ft_str_vector>(strs), run_push_back<std_str_vector>(strs));
+	bench::report("push_back(temporary)", n, run_push_back_temporary<ft_str_vector>(strs), run_push_back_temporary<std_str_vector>(strs));
+	bench::report("insert(begin) x rounds", n, run_insert_front<ft_str_vector>(strs, rounds), run_insert_front<std_str_vector>(strs, rounds));
+	bench::report("push_back(vector<int>(16))", n, run_nested_push_back<ft_nested_vector, ft::vector<int> >(n),
+		run_nested_push_back<std_nested_vector, std::vector<int> >(n));
+}
+
+template <typename Map, typename Pair>
+double run_map_insert(const std::vector<std::string>& strs)
+{
+	bench::Timer timer;
+	Map mp;
+	for (size_t i = 0; i < strs.size(); ++i)
+		mp.insert(Pair(static_cast<int>(i), strs[i]));
+	bench::sink(static_cast<long>(mp.size()));
+	return (timer.ms());
+}
+
+#if __cplusplus >= 201103L
+template <typename Map>
+double run_map_emplace(const std::vector<std::string>& strs)
+{
+	bench::Timer timer;
+	Map mp;
+	for (size_t i = 0; i < strs.size(); ++i)
+		mp.emplace(static_cast<int>(i), strs[i]);
+	bench::sink(static_cast<long>(mp.size()));
+	return (timer.ms());
+}
+#endif
+
+#if __cplusplus >= 201703L
+//절반은 이미 있는 key. try_emplace는 key가 있으면 문자열을 만들지 않는다.
+template <typename Map>
+double run_map_try_emplace(const std::vector<std::string>& strs)
+{
+	bench::Timer timer;
+	Map mp;
+	for (size_t i = 0; i < strs.size(); ++i)
+		mp.try_emplace(static_cast<int>(i / 2), strs[i]);
+	bench::sink(static_cast<long>(mp.size()));
+	return (timer.ms());
+}
+#endif
+
+//map<int, string>: insert(pair) / emplace / try_emplace
+void bench_map(long n)
+{
+	std::vector<std::string> strs = make_strings(n);
+
+	bench::report("insert(value_type)", n, run_map_insert<ft_str_map, ft::pair<const int, std::string> >(strs),
+		run_map_insert<std_str_map, std::pair<const int, std::string> >(strs));
+#if __cplusplus >= 201103L
+	bench::report("emplace(key, string)", n, run_map_emplace<ft_str_map>(strs), run_map_emplace<std_str_map>(strs));
+#endif
+#if __cplusplus >= 201703L
+	bench::report("try_emplace (half dup)", n, run_map_try_emplace<ft_str_map>(strs), run_map_try_emplace<std_str_map>(strs));
+#endif
+}
+
+//move constructor: c++98은 복사
+void bench_move_construct(long n)
+{
+	std::vector<std::string> strs = make_strings(n);
+	ft_str_vector ft_v(strs.begin(), strs.end());
+	std_str_vector std_v(strs.begin(), strs.end());
+	ft_str_map ft_mp;
+	std_str_map std_mp;
+	for (long i = 0; i < n; ++i)
+	{
+		ft_mp[static_cast<int>(i)] = strs[i];
+		std_mp[static_cast<int>(i)] = strs[i];
+	}
+
+	bench::Timer timer;
+	ft_str_vector ft_v2(FT_MOVE(ft_v));
+	double ft_ms = timer.ms();
+	timer.reset();
+	std_str_vector std_v2(FT_MOVE(std_v));
+	bench::report("vector(vector&&)", n, ft_ms, timer.ms());
+
+	timer.reset();
+	ft_str_map ft_mp2(FT_MOVE(ft_mp));
+	ft_ms = timer.ms();
+	timer.reset();
+	std_str_map std_mp2(FT_MOVE(std_mp));
+	bench::report("map(map&&)", n, ft_ms, timer.ms());
+	bench::sink(static_cast<long>(ft_v2.size() + std_v2.size() + ft_mp2.size() + std_mp2.size()));
+}
+
+int main(int argc, char** argv)
+{
+	long max_n = bench::max_elements(argc, argv, 1000000);
+
+	std::cout << "c++ standard: " << __cplusplus << std::endl;
+	bench::title("vector<string>: push_back | insert(begin) | vector<vector<int> >");
+	for (long n = 1000; n <= max_n; n *= 10)
+		bench_vector(n);
+
+	bench::title("map<int, string>: insert | emplace | try_emplace");
+	for (long n = 1000; n <= max_n; n *= 10)
+		bench_map(n);
+
+	bench::title("move constructor (c++98: copy)");
+	for (long n = 1000; n <= max_n; n *= 10)
+		bench_move_construct(n);
+	return (0);
+}
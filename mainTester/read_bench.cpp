@@ -0,0 +1,146 @@
+#include "vector.hpp"
+#include "bench.hpp"
+#include <vector>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * read buffer benchmark
+ * usage: ./read_bench [file_mb]
+ * file_mb(기본 512)MB 크기의 임시 파일을 만들고, 1MB씩 read()로 vector<char> 끝에 이어 붙여 파일 전체를 읽는다.
+ * 매번 buffer를 chunk만큼 늘린 뒤 read()가 그 자리를 덮어쓰고, 실제로 읽은 크기로 다시 줄인다.
+ * resize는 늘어난 바이트를 0으로 채우지만, resize_default_init은 크기만 바꾼다.
+ * 파일은 방금 썼으므로 page cache에 있다. -> 디스크가 아닌 memory copy 비용과 buffer를 늘리는 비용을 비교한다.
+ */
+
+#define CHUNK (1 << 20)
+
+typedef ft::vector<char>	ft_buffer;
+typedef std::vector<char>	std_buffer;
+
+static const char*	g_path = "read_bench.tmp";
+
+static bool make_file(long mb)
+{
+	int fd = open(g_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (false);
+	std::vector<char> chunk(CHUNK);
+	bench::Random rand;
+	for (size_t i = 0; i < chunk.size(); ++i)
+		chunk[i] = static_cast<char>(rand.next());
+	for (long i = 0; i < mb; ++i)
+	{
+		if (write(fd, &chunk[0], chunk.size()) != static_cast<ssize_t>(chunk.size()))
+		{
+			close(fd);
+			return (false);
+		}
+	}
+	close(fd);
+	return (true);
+}
+
+//resize(used + CHUNK)로 늘린 뒤 읽는다.
+template <typename Buffer>
+double run_read_resize(Buffer& buf)
+{
+	int fd = open(g_path, O_RDONLY);
+	bench::Timer timer;
+	size_t used = 0;
+	while (true)
+	{
+		buf.resize(used + CHUNK);
+		ssize_t n = read(fd, &buf[0] + used, CHUNK);
+		if (n <= 0)
+			break ;
+		used += static_cast<size_t>(n);
+	}
+	buf.resize(used);
+	double ms = timer.ms();
+	close(fd);
+	return (ms);
+}
+
+//resize_default_init(used + CHUNK)로 늘린 뒤 읽는다.
+double run_read_default_init(ft_buffer& buf)
+{
+	int fd = open(g_path, O_RDONLY);
+	bench::Timer timer;
+	size_t used = 0;
+	while (true)
+	{
+		buf.resize_default_init(used + CHUNK);
+		ssize_t n = read(fd, &buf[0] + used, CHUNK);
+		if (n <= 0)
+			break ;
+		used += static_cast<size_t>(n);
+	}
+	buf.resize_default_init(used);
+	double ms = timer.ms();
+	close(fd);
+	return (ms);
+}
+
+//read 없이 buffer를 CHUNK씩 늘리는 비용만 잰다. (이미 할당된 capacity 안에서)
+template <typename Buffer>
+double run_grow_resize(Buffer& buf, long total)
+{
+	buf.reserve(static_cast<size_t>(total));
+	bench::Timer timer;
+	for (long used = 0; used < total; used += CHUNK)
+		buf.resize(static_cast<size_t>(used + CHUNK));
+	bench::sink(static_cast<long>(buf.size()));
+	return (timer.ms());
+}
+
+double run_grow_default_init(ft_buffer& buf, long total)
+{
+	buf.reserve(static_cast<size_t>(total));
+	bench::Timer timer;
+	for (long used = 0; used < total; used += CHUNK)
+		buf.resize_default_init(static_cast<size_t>(used + CHUNK));
+	bench::sink(static_cast<long>(buf.size()));
+	return (timer.ms());
+}
+
+int main(int argc, char** argv)
+{
+	long mb = bench::max_elements(argc, argv, 512);
+	long total = mb * CHUNK;
+
+	if (!make_file(mb))
+	{
+		std::cerr << "cannot create " << g_path << std::endl;
+		return (1);
+	}
+
+	bench::title("read() whole file into vector<char>, 1MB chunks");
+	{
+		ft_buffer ft_buf;
+		std_buffer std_buf;
+		bench::report("resize + read", total, run_read_resize(ft_buf), run_read_resize(std_buf));
+	}
+	{
+		ft_buffer ft_buf;
+		std_buffer std_buf;
+		double ft_ms = run_read_default_init(ft_buf);
+		bench::report("resize_default_init + read", total, ft_ms, run_read_resize(std_buf), "ft", "std resize");
+		bool same = ft_buf.size() == std_buf.size() && ft::equal(std_buf.begin(), std_buf.end(), ft_buf.begin());
+		std::cout << "    contents equal: " << (same ? "yes" : "no") << std::endl;
+	}
+
+	bench::title("grow buffer only (capacity reserved)");
+	{
+		ft_buffer ft_buf;
+		ft_buffer ft_buf2;
+		std_buffer std_buf;
+		double zero_ms = run_grow_resize(ft_buf, total);
+		double default_ms = run_grow_default_init(ft_buf2, total);
+		bench::report("resize", total, zero_ms, run_grow_resize(std_buf, total));
+		bench::report("resize_default_init", total, default_ms, zero_ms, "ft", "ft resize");
+	}
+	std::remove(g_path);
+	return (0);
+}
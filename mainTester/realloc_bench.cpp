@@ -0,0 +1,86 @@
+#include "vector.hpp"
+#include "bench.hpp"
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * realloc growth benchmark
+ * usage: ./realloc_bench [max_elements]
+ * long을 push_back으로 10^3 부터 max_elements(기본 10^8, 800MB)개까지 늘리며 걸린 시간과 peak RSS를 비교한다.
+ * 새로 할당해서 옮기면 재할당 순간 옛 buffer와 새 buffer(옮겨진 부분)가 같이 있으므로 peak가 옛 capacity의 두 배가 된다.
+ * realloc_allocator는 큰 buffer를 mremap으로 늘리므로 peak가 실제 데이터 크기와 같다.
+ * 실행마다 fork해서 child의 peak RSS(ru_maxrss)를 따로 잰다.
+ */
+
+typedef ft::vector<long>								ft_vector;
+typedef ft::vector<long, ft::realloc_allocator<long> >	ft_realloc_vector;
+typedef std::vector<long>								std_vector;
+
+struct result
+{
+	double	ms;
+	long	peak_mb;
+};
+
+template <typename Vector>
+void run_push_back(long n, int fd)
+{
+	bench::Timer timer;
+	Vector v;
+	for (long i = 0; i < n; ++i)
+		v.push_back(i);
+	double ms = timer.ms();
+	bench::sink(v[static_cast<size_t>(n / 2)]);
+	if (write(fd, &ms, sizeof(ms)) != sizeof(ms))
+		std::exit(1);
+}
+
+//child process에서 run을 실행하고 시간과 peak RSS를 받는다.
+template <typename Vector>
+result measure(long n)
+{
+	result res = {0, 0};
+	int fds[2];
+	if (pipe(fds) != 0)
+		return (res);
+	pid_t pid = fork();
+	if (pid == 0)
+	{
+		close(fds[0]);
+		run_push_back<Vector>(n, fds[1]);
+		std::exit(0);
+	}
+	close(fds[1]);
+	if (read(fds[0], &res.ms, sizeof(res.ms)) != sizeof(res.ms))
+		res.ms = -1;
+	close(fds[0]);
+	int status;
+	struct rusage usage;
+	if (pid > 0 && wait4(pid, &status, 0, &usage) == pid)
+		res.peak_mb = usage.ru_maxrss / 1024;
+	return (res);
+}
+
+void bench_growth(long n)
+{
+	result ft_res = measure<ft_vector>(n);
+	result realloc_res = measure<ft_realloc_vector>(n);
+	result std_res = measure<std_vector>(n);
+
+	bench::report("push_back (allocate + copy)", n, ft_res.ms, std_res.ms);
+	bench::report("push_back (realloc)", n, realloc_res.ms, std_res.ms);
+	std::cout << "    peak RSS: ft " << ft_res.peak_mb << " MB   ft realloc " << realloc_res.peak_mb
+		<< " MB   std " << std_res.peak_mb << " MB   (data " << n * sizeof(long) / (1024 * 1024) << " MB)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	long max_n = bench::max_elements(argc, argv, 100000000);
+
+	bench::title("vector<long> growth: time | peak RSS");
+	for (long n = 1000; n <= max_n; n *= 10)
+		bench_growth(n);
+	return (0);
+}
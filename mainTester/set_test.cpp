@@ -1,4 +1,7 @@
 #include "set.hpp"
+#include "btree_set.hpp"
+#include "flat_set.hpp"
+#include "unordered_set.hpp"
 #include <iostream>
 #include <string>
 #include <list>
@@ -136,4 +139,136 @@ int main() {
 	std::cout << "operator<=: " << ((lhs <= rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>:  " << ((lhs > rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>=: " << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
-} 
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== threaded set =====" << std::endl;
+	{
+		//ft의 threaded set을 TESTED_NAMESPACE set과 같은 순서로 순회하고, showTree로 출력할 수 있는지 확인한다.
+		typedef ft::set<T1, ft::less<T1>, std::allocator<T1>, false, true> threaded_set;
+		threaded_set st_thread;
+		TESTED_NAMESPACE::set<T1> st_ref;
+		for (int i = 1; i <= 5; ++i)
+		{
+			st_thread.insert(i * 10);
+			st_ref.insert(i * 10);
+		}
+		bool same = st_thread.size() == st_ref.size() && ft::equal(st_ref.begin(), st_ref.end(), st_thread.begin());
+		std::cout << "elements: " << (same ? "OK" : "KO") << std::endl;
+		st_thread.showTree();
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== pool allocator =====" << std::endl;
+	{
+		//ft::pool_allocator를 넘긴 set은 노드를 slab pool에서 할당한다. erase로 free list를 재사용하고 swap/copy/clear를 거친다.
+		typedef ft::set<T1, ft::less<T1>, ft::pool_allocator<T1> > pool_set;
+		pool_set st_pool;
+		TESTED_NAMESPACE::set<T1> st_ref;
+		for (int i = 0; i < 100; ++i)
+		{
+			st_pool.insert((i * 7) % 53);
+			st_ref.insert((i * 7) % 53);
+			if (i % 4 == 0)
+			{
+				st_pool.erase((i * 3) % 53);
+				st_ref.erase((i * 3) % 53);
+			}
+		}
+		pool_set st_other;
+		st_other.insert(-1);
+		st_other.swap(st_pool);
+		bool same = st_other.size() == st_ref.size() && ft::equal(st_ref.begin(), st_ref.end(), st_other.begin());
+		std::cout << "after swap: " << (same ? "OK" : "KO") << ", other: " << st_pool.size() << " " << *st_pool.begin() << std::endl;
+		st_pool = st_other;
+		st_other.clear();
+		st_other.insert(7);
+		same = st_pool.size() == st_ref.size() && ft::equal(st_ref.begin(), st_ref.end(), st_pool.begin());
+		std::cout << "after copy | clear: " << (same ? "OK" : "KO") << ", cleared: " << st_other.size() << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== flat set =====" << std::endl;
+	{
+		//정렬되지 않고 중복이 있는 입력으로 ft::flat_set을 만들고, batch insert/erase 후 TESTED_NAMESPACE set과 비교한다.
+		lst.clear();
+		for (int i = 0; i < 200; ++i)
+			lst.push_back(T3((i * 37) % 101));
+		ft::flat_set<T1> st_flat(lst.begin(), lst.end());
+		TESTED_NAMESPACE::set<T1> st_ref(lst.begin(), lst.end());
+		lst.clear();
+		for (int i = 0; i < 100; ++i)
+			lst.push_back(T3((i * 53) % 211));
+		st_flat.insert(lst.begin(), lst.end());
+		st_ref.insert(lst.begin(), lst.end());
+		for (int i = 0; i < 30; ++i)
+		{
+			st_flat.insert(i * 7 + 300);
+			st_ref.insert(i * 7 + 300);
+			st_flat.erase((i * 17) % 211);
+			st_ref.erase((i * 17) % 211);
+		}
+		st_flat.erase(st_flat.lower_bound(40), st_flat.lower_bound(60));
+		st_ref.erase(st_ref.lower_bound(40), st_ref.lower_bound(60));
+		bool same = st_flat.size() == st_ref.size();
+		ft::flat_set<T1>::const_iterator it = st_flat.begin();
+		for (TESTED_NAMESPACE::set<T1>::iterator ref = st_ref.begin(); same && ref != st_ref.end(); ++ref, ++it)
+			same = *it == *ref;
+		std::cout << "size: " << st_flat.size() << " / " << st_ref.size() << std::endl;
+		std::cout << "elements: " << (same ? "OK" : "KO") << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== unordered set =====" << std::endl;
+	{
+		//insert/erase 후 TESTED_NAMESPACE set과 같은 원소를 가지는지 확인한다.
+		ft::unordered_set<T1> st_hash;
+		TESTED_NAMESPACE::set<T1> st_ref;
+		for (int i = 0; i < 500; ++i)
+		{
+			st_hash.insert((i * 37) % 211);
+			st_ref.insert((i * 37) % 211);
+			if (i % 3 == 0)
+			{
+				st_hash.erase((i * 13) % 211);
+				st_ref.erase((i * 13) % 211);
+			}
+		}
+		size_t visited = 0;
+		for (ft::unordered_set<T1>::iterator it = st_hash.begin(); it != st_hash.end(); ++it)
+			visited += st_ref.count(*it);
+		std::cout << "size: " << st_hash.size() << " / " << st_ref.size() << std::endl;
+		std::cout << "elements: " << (visited == st_ref.size() && st_hash.size() == st_ref.size() ? "OK" : "KO") << std::endl;
+	}
+
+#if __cplusplus >= 201103L
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== move | emplace (c++11) =====" << std::endl;
+	{
+		TESTED_NAMESPACE::set<std::string> st_move;
+		std::cout << "emplace(3, 'a'): " << *st_move.emplace(3, 'a').first << std::endl;
+		std::cout << "emplace(\"aaa\") again: " << st_move.emplace("aaa").second << std::endl;
+		std::cout << "emplace_hint(end, \"zz\"): " << *st_move.emplace_hint(st_move.end(), "zz") << std::endl;
+		std::string moved("bb");
+		std::cout << "insert(move): " << st_move.insert(std::move(moved)).second << std::endl;
+		TESTED_NAMESPACE::set<std::string> st_moved(std::move(st_move));
+		std::cout << "after move constructor: " << st_move.size() << " " << st_moved.size() << std::endl;
+		st_move = std::move(st_moved);
+		std::cout << "after move assignment: " << st_move.size() << " " << st_moved.size() << std::endl;
+		for (TESTED_NAMESPACE::set<std::string>::iterator it = st_move.begin(); it != st_move.end(); ++it)
+			std::cout << "- key: " << *it << std::endl;
+	}
+	{
+		//ft::flat_set도 같은 c++11 interface를 가진다.
+		ft::flat_set<std::string> st_flat;
+		std::cout << "flat emplace(3, 'a'): " << *st_flat.emplace(3, 'a').first << ", again: " << st_flat.emplace("aaa").second << std::endl;
+		std::cout << "flat emplace_hint(begin, \"0\"): " << *st_flat.emplace_hint(st_flat.begin(), "0") << std::endl;
+		st_flat.insert(std::string("m"));
+		ft::flat_set<std::string> st_moved(std::move(st_flat));
+		std::cout << "flat after move constructor: " << st_flat.size() << " " << st_moved.size() << std::endl;
+		st_flat = std::move(st_moved);
+		std::cout << "flat after move assignment: " << st_flat.size() << " " << st_moved.size() << std::endl;
+		for (ft::flat_set<std::string>::iterator it = st_flat.begin(); it != st_flat.end(); ++it)
+			std::cout << "- key: " << *it << std::endl;
+	}
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,421 @@
+#include "vector.hpp"
+#include "bench.hpp"
+#include <vector>
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+#include <new>
+#include <cstdlib>
+
+/**
+ * vector benchmark
+ * usage: ./vector_bench [max_elements]
+ * 10^3 부터 max_elements(기본 10^7)까지 100배씩 늘리며 ft::vector와 std::vector를 비교한다.
+ * growth factor를 바꿔 보려면 BENCH_FLAGS="-DFT_VECTOR_GROWTH_NUM=3 -DFT_VECTOR_GROWTH_DEN=2" 로 compile한다.
+ */
+
+//중간 삽입은 O(N^2)이므로 원소 수를 제한한다.
+#define MID_INSERT_MAX 100000
+#define CHUNK 16
+//fill은 원소당 비용이 작으므로 10^8까지 잰다.
+#define FILL_MAX 100000000L
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+# pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+//재할당 횟수 측정을 위해 operator new를 교체해 할당 횟수와 바이트 수를 센다.
+static size_t	g_alloc_count = 0;
+static size_t	g_alloc_bytes = 0;
+
+void* operator new(std::size_t size) BENCH_THROW_BAD_ALLOC
+{
+	++g_alloc_count;
+	g_alloc_bytes += size;
+	void* p = std::malloc(size);
+	if (p == NULL)
+		throw std::bad_alloc();
+	return (p);
+}
+
+void operator delete(void* p) BENCH_NOTHROW
+{
+	std::free(p);
+}
+
+//c++14부터는 크기를 받는 operator delete도 같이 교체해야 한다.
+#if __cplusplus >= 201402L
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+#endif
+
+typedef ft::vector<int>		ft_vector;
+typedef std::vector<int>	std_vector;
+
+//한 번 실행하는 동안의 할당 횟수
+static size_t	g_last_allocs = 0;
+
+template <typename Vector>
+double run_push_back(long n)
+{
+	size_t count = g_alloc_count;
+	bench::Timer timer;
+	Vector v;
+	for (long i = 0; i < n; ++i)
+		v.push_back(static_cast<int>(i));
+	bench::sink(static_cast<long>(v.size()));
+	double ms = timer.ms();
+	g_last_allocs = g_alloc_count - count;
+	return (ms);
+}
+
+//CHUNK개씩 range insert로 뒤에 붙인다.
+template <typename Vector>
+double run_range_append(long n, const std::vector<int>& chunk)
+{
+	size_t count = g_alloc_count;
+	bench::Timer timer;
+	Vector v;
+	for (long i = 0; i < n; i += CHUNK)
+		v.insert(v.end(), chunk.begin(), chunk.end());
+	bench::sink(static_cast<long>(v.size()));
+	double ms = timer.ms();
+	g_last_allocs = g_alloc_count - count;
+	return (ms);
+}
+
+//CHUNK개씩 fill insert로 뒤에 붙인다.
+template <typename Vector>
+double run_fill_append(long n)
+{
+	size_t count = g_alloc_count;
+	bench::Timer timer;
+	Vector v;
+	for (long i = 0; i < n; i += CHUNK)
+		v.insert(v.end(), CHUNK, static_cast<int>(i));
+	bench::sink(static_cast<long>(v.size()));
+	double ms = timer.ms();
+	g_last_allocs = g_alloc_count - count;
+	return (ms);
+}
+
+//한 칸씩 resize
+template <typename Vector>
+double run_resize_grow(long n)
+{
+	size_t count = g_alloc_count;
+	bench::Timer timer;
+	Vector v;
+	for (long i = 1; i <= n; ++i)
+		v.resize(static_cast<size_t>(i), static_cast<int>(i));
+	bench::sink(static_cast<long>(v.size()));
+	double ms = timer.ms();
+	g_last_allocs = g_alloc_count - count;
+	return (ms);
+}
+
+//같은 결과에 할당 횟수를 덧붙여 출력한다.
+template <typename FtRun, typename StdRun>
+void report_allocs(const std::string& name, long n, FtRun ft_run, StdRun std_run)
+{
+	double ft_ms = ft_run(n);
+	size_t ft_allocs = g_last_allocs;
+	double std_ms = std_run(n);
+	size_t std_allocs = g_last_allocs;
+	bench::report(name, n, ft_ms, std_ms);
+	std::cout << "    allocations: ft " << ft_allocs << "   std " << std_allocs << std::endl;
+}
+
+//뒤에 붙이기: push_back, range insert, fill insert, resize
+void bench_append(long n)
+{
+	std::vector<int> chunk(CHUNK, 1);
+	report_allocs("push_back", n, run_push_back<ft_vector>, run_push_back<std_vector>);
+
+	double ft_ms = run_range_append<ft_vector>(n, chunk);
+	size_t ft_allocs = g_last_allocs;
+	double std_ms = run_range_append<std_vector>(n, chunk);
+	bench::report("insert(end, range of 16)", n, ft_ms, std_ms);
+	std::cout << "    allocations: ft " << ft_allocs << "   std " << g_last_allocs << std::endl;
+
+	report_allocs("insert(end, 16, val)", n, run_fill_append<ft_vector>, run_fill_append<std_vector>);
+	report_allocs("resize(size + 1)", n, run_resize_grow<ft_vector>, run_resize_grow<std_vector>);
+}
+
+//가운데에 하나씩 / CHUNK개씩 삽입한다.
+template <typename Vector>
+double run_mid_insert(long n, long step, const std::vector<int>& chunk)
+{
+	size_t count = g_alloc_count;
+	bench::Timer timer;
+	Vector v;
+	for (long i = 0; i < n; i += step)
+	{
+		if (step == 1)
+			v.insert(v.begin() + v.size() / 2, static_cast<int>(i));
+		else
+			v.insert(v.begin() + v.size() / 2, chunk.begin(), chunk.end());
+	}
+	bench::sink(static_cast<long>(v.size()));
+	double ms = timer.ms();
+	g_last_allocs = g_alloc_count - count;
+	return (ms);
+}
+
+void bench_mid_insert(long n)
+{
+	std::vector<int> chunk(CHUNK, 1);
+
+	double ft_ms = run_mid_insert<ft_vector>(n, 1, chunk);
+	size_t ft_allocs = g_last_allocs;
+	double std_ms = run_mid_insert<std_vector>(n, 1, chunk);
+	bench::report("insert(mid, val)", n, ft_ms, std_ms);
+	std::cout << "    allocations: ft " << ft_allocs << "   std " << g_last_allocs << std::endl;
+
+	ft_ms = run_mid_insert<ft_vector>(n, CHUNK, chunk);
+	ft_allocs = g_last_allocs;
+	std_ms = run_mid_insert<std_vector>(n, CHUNK, chunk);
+	bench::report("insert(mid, range of 16)", n, ft_ms, std_ms);
+	std::cout << "    allocations: ft " << ft_allocs << "   std " << g_last_allocs << std::endl;
+}
+
+//16 ~ 64바이트 POD record. 재할당과 erase가 원소를 memmove로 옮기는지 비교한다.
+struct record
+{
+	long	id;
+	long	time;
+	double	value;
+	int		flags[2];
+};
+
+typedef ft::vector<record>	ft_record_vector;
+typedef std::vector<record>	std_record_vector;
+
+template <typename Vector>
+double run_record_push_back(long n)
+{
+	bench::Timer timer;
+	Vector v;
+	record r = {0, 0, 0.0, {0, 0}};
+	for (long i = 0; i < n; ++i)
+	{
+		r.id = i;
+		v.push_back(r);
+	}
+	bench::sink(v.back().id);
+	return (timer.ms());
+}
+
+//가운데 원소를 지우고 다시 넣는 것을 rounds번 반복한다.
+template <typename Vector>
+double run_record_erase_insert(long n, long rounds)
+{
+	record r = {0, 0, 0.0, {0, 0}};
+	Vector v(static_cast<size_t>(n), r);
+	bench::Timer timer;
+	for (long i = 0; i < rounds; ++i)
+	{
+		r.id = i;
+		v.erase(v.begin() + n / 2);
+		v.insert(v.begin() + n / 2, r);
+	}
+	bench::sink(v[n / 2].id);
+	return (timer.ms());
+}
+
+//앞쪽 n / 100개를 한 번에 지우는 것을 100번 반복한다. (queue처럼 소비)
+template <typename Vector>
+double run_record_erase_front(long n)
+{
+	record r = {0, 0, 0.0, {0, 0}};
+	Vector v(static_cast<size_t>(n), r);
+	bench::Timer timer;
+	long step = std::max(1L, n / 100);
+	while (static_cast<long>(v.size()) >= step)
+		v.erase(v.begin(), v.begin() + step);
+	bench::sink(static_cast<long>(v.size()));
+	return (timer.ms());
+}
+
+void bench_record(long n)
+{
+	long rounds = std::max(1L, 100000000L / n);
+	bench::report("push_back (32B record)", n, run_record_push_back<ft_record_vector>(n), run_record_push_back<std_record_vector>(n));
+	bench::report("erase + insert(mid)", n, run_record_erase_insert<ft_record_vector>(n, rounds),
+		run_record_erase_insert<std_record_vector>(n, rounds));
+	bench::report("erase(front, n / 100)", n, run_record_erase_front<ft_record_vector>(n), run_record_erase_front<std_record_vector>(n));
+}
+
+//spike: n개까지 늘었다가 n / 100개만 남는 vector. shrink_to_fit 전후의 capacity
+//std::vector는 c++98에 shrink_to_fit이 없으므로 copy-and-swap으로 줄인다.
+void bench_shrink(long n)
+{
+	ft_vector ft_v;
+	std_vector std_v;
+	for (long i = 0; i < n; ++i)
+	{
+		ft_v.push_back(static_cast<int>(i));
+		std_v.push_back(static_cast<int>(i));
+	}
+	ft_v.erase(ft_v.begin() + n / 100, ft_v.end());
+	std_v.erase(std_v.begin() + n / 100, std_v.end());
+	size_t ft_before = ft_v.capacity();
+
+	bench::Timer timer;
+	ft_v.shrink_to_fit();
+	double ft_ms = timer.ms();
+	timer.reset();
+	std_vector(std_v).swap(std_v);
+	double std_ms = timer.ms();
+
+	bench::report("shrink after spike", n, ft_ms, std_ms, "ft", "std swap");
+	std::cout << "    capacity: " << ft_before << " -> ft " << ft_v.capacity() << "   std " << std_v.capacity() << std::endl;
+}
+
+//vector(n, val), assign(n, val), resize(n, val), clear()
+template <typename Vector, typename T>
+double run_fill_construct(long n, T val)
+{
+	bench::Timer timer;
+	Vector v(static_cast<size_t>(n), val);
+	bench::sink(static_cast<long>(v[static_cast<size_t>(n / 2)]));
+	return (timer.ms());
+}
+
+template <typename Vector, typename T>
+double run_fill_assign_resize(long n, T val)
+{
+	Vector v;
+	v.reserve(static_cast<size_t>(n));
+	bench::Timer timer;
+	v.assign(static_cast<size_t>(n / 2), val);
+	v.resize(static_cast<size_t>(n), val);
+	bench::sink(static_cast<long>(v[static_cast<size_t>(n - 1)]));
+	return (timer.ms());
+}
+
+template <typename Vector>
+double run_clear(long n)
+{
+	Vector v(static_cast<size_t>(n), 1);
+	bench::Timer timer;
+	v.clear();
+	double ms = timer.ms();
+	bench::sink(static_cast<long>(v.size()));
+	return (ms);
+}
+
+typedef ft::vector<char>	ft_char_vector;
+typedef std::vector<char>	std_char_vector;
+typedef ft::vector<double>	ft_double_vector;
+typedef std::vector<double>	std_double_vector;
+
+void bench_fill(long n)
+{
+	bench::report("vector<int>(n, 0)", n, run_fill_construct<ft_vector>(n, 0), run_fill_construct<std_vector>(n, 0));
+	bench::report("vector<int>(n, 7)", n, run_fill_construct<ft_vector>(n, 7), run_fill_construct<std_vector>(n, 7));
+	bench::report("vector<char>(n, 'x')", n, run_fill_construct<ft_char_vector>(n, 'x'), run_fill_construct<std_char_vector>(n, 'x'));
+	bench::report("vector<double>(n, 1.5)", n, run_fill_construct<ft_double_vector>(n, 1.5), run_fill_construct<std_double_vector>(n, 1.5));
+	bench::report("assign(n/2, 7) + resize(n, 7)", n, run_fill_assign_resize<ft_vector>(n, 7), run_fill_assign_resize<std_vector>(n, 7));
+	bench::report("clear() vector<int>", n, run_clear<ft_vector>(n), run_clear<std_vector>(n));
+}
+
+//range constructor / assign. random access iterator는 원소 수를 O(1)로 구한다.
+template <typename Vector, typename Iterator>
+double run_range_construct(Iterator first, Iterator last)
+{
+	bench::Timer timer;
+	Vector v(first, last);
+	v.assign(first, last);
+	bench::sink(static_cast<long>(v[v.size() / 2] + v.back()));
+	return (timer.ms());
+}
+
+//istream_iterator: 한 번만 읽을 수 있는 input iterator
+template <typename Vector>
+double run_stream_construct(const std::string& text)
+{
+	std::istringstream in(text);
+	bench::Timer timer;
+	Vector v((std::istream_iterator<int>(in)), std::istream_iterator<int>());
+	bench::sink(static_cast<long>(v.size() + v.back()));
+	return (timer.ms());
+}
+
+void bench_range_construct(long n)
+{
+	ft_vector ft_src(static_cast<size_t>(n), 1);
+	std_vector std_src(static_cast<size_t>(n), 1);
+	bench::report("vector(vector range) + assign", n, run_range_construct<ft_vector>(ft_src.begin(), ft_src.end()),
+		run_range_construct<std_vector>(std_src.begin(), std_src.end()));
+
+	std::list<int> lst(static_cast<size_t>(n), 1);
+	bench::report("vector(list range) + assign", n, run_range_construct<ft_vector>(lst.begin(), lst.end()),
+		run_range_construct<std_vector>(lst.begin(), lst.end()));
+
+	std::ostringstream out;
+	for (long i = 0; i < n; ++i)
+		out << i << ' ';
+	bench::report("vector(istream_iterator)", n, run_stream_construct<ft_vector>(out.str()), run_stream_construct<std_vector>(out.str()));
+}
+
+//swap-to-publish double buffering: n개짜리 vector 두 개를 SWAP_ROUNDS번 바꾼다.
+//swap이 O(1)이면 n과 관계없이 시간이 같아야 한다.
+#define SWAP_ROUNDS 1000000
+
+template <typename Vector>
+double run_swap(long n)
+{
+	Vector front(static_cast<size_t>(n), 1);
+	Vector back(static_cast<size_t>(n), 1);
+	bench::Timer timer;
+	for (long i = 0; i < SWAP_ROUNDS; ++i)
+	{
+		back[static_cast<size_t>(i % n)] = static_cast<int>(i);
+		front.swap(back);
+	}
+	bench::sink(static_cast<long>(front[0] + back[0]));
+	return (timer.ms());
+}
+
+void bench_swap(long n)
+{
+	bench::report("swap x 10^6 (equal size)", n, run_swap<ft_vector>(n), run_swap<std_vector>(n));
+}
+
+int main(int argc, char** argv)
+{
+	long max_n = bench::max_elements(argc, argv, 10000000);
+
+	bench::title("append: push_back | insert(end) | resize");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_append(n);
+
+	bench::title("insert in the middle");
+	for (long n = 1000; n <= std::min(max_n, static_cast<long>(MID_INSERT_MAX)); n *= 10)
+		bench_mid_insert(n);
+
+	bench::title("POD records: push_back | erase + insert(mid) (10^8 moved) | erase(front)");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_record(n);
+
+	bench::title("shrink_to_fit");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_shrink(n);
+
+	bench::title("fill: vector(n, val) | assign + resize | clear");
+	for (long n = 1000; n <= std::min(max_n * 10, FILL_MAX); n *= 10)
+		bench_fill(n);
+
+	bench::title("range constructor + assign: vector | list | istream_iterator");
+	for (long n = 1000; n <= max_n; n *= 100)
+		bench_range_construct(n);
+
+	bench::title("swap: 10^6 swaps, time must not depend on n");
+	for (long n = 1000; n <= max_n; n *= 10)
+		bench_swap(n);
+	return (0);
+}
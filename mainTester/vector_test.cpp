@@ -2,6 +2,9 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <list>
+#include <sstream>
+#include <iterator>
 
 #ifndef TESTED_NAMESPACE
 #define TESTED_NAMESPACE ft
@@ -10,6 +13,12 @@
 #define TYPE int
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::vector<T>::size_type
 
+//operator==가 없는 type. swap은 원소를 비교하지 않아야 한다.
+struct no_equal
+{
+	int	value;
+};
+
 template <typename T>
 void printContainers(TESTED_NAMESPACE::vector<T> const &vec, bool print_content = true) {
 	const T_SIZE_TYPE size = vec.size();
@@ -28,6 +37,26 @@ void printContainers(TESTED_NAMESPACE::vector<T> const &vec, bool print_content
 	std::cout << "------------------------" << std::endl;
 }
 
+//생성/소멸 횟수를 센다. -> 살아 있는 원소 수가 std와 같아야 한다.
+struct tracked {
+	int value;
+	static int live;
+
+	tracked(int v = 0) : value(v) { ++live; }
+	tracked(tracked const &other) : value(other.value) { ++live; }
+	~tracked() { --live; value = -1; }
+	tracked &operator=(tracked const &other) {
+		value = other.value;
+		return (*this);
+	}
+};
+
+int tracked::live = 0;
+
+std::ostream &operator<<(std::ostream &os, tracked const &t) {
+	return (os << t.value);
+}
+
 int main() {
 	std::cout << "################ Test Vector ################" << std::endl;
 
@@ -134,6 +163,33 @@ int main() {
 	printContainers(vecA);
 	printContainers(vecB);
 
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== input | bidirectional iterator range =====" << std::endl;
+	std::istringstream v_in("1 2 3 4 5");
+	TESTED_NAMESPACE::vector<TYPE> v_stream((std::istream_iterator<TYPE>(v_in)), std::istream_iterator<TYPE>());
+	printContainers(v_stream);
+	std::istringstream v_in_mid("7 8 9");
+	v_stream.insert(v_stream.begin() + 2, std::istream_iterator<TYPE>(v_in_mid), std::istream_iterator<TYPE>());
+	std::istringstream v_in_end("10 11");
+	v_stream.insert(v_stream.end(), std::istream_iterator<TYPE>(v_in_end), std::istream_iterator<TYPE>());
+	printContainers(v_stream);
+	std::list<TYPE> v_list;
+	for (unsigned int i = 0; i < v_stream.size(); ++i)
+		v_list.push_front(v_stream[i]);
+	vecA.assign(v_list.begin(), v_list.end());
+	printContainers(vecA);
+	std::istringstream v_in_assign("6 5 4");
+	vecA.assign(std::istream_iterator<TYPE>(v_in_assign), std::istream_iterator<TYPE>());
+	printContainers(vecA);
+	std::list<TYPE>::iterator v_list_it = v_list.begin();
+	TESTED_NAMESPACE::advance(v_list_it, 3);
+	TESTED_NAMESPACE::vector<TYPE>::iterator v_stream_it = v_stream.begin();
+	TESTED_NAMESPACE::advance(v_stream_it, 4);
+	TESTED_NAMESPACE::advance(v_stream_it, -1);
+	std::cout << "distance: " << TESTED_NAMESPACE::distance(v_list.begin(), v_list.end()) << " "
+		<< TESTED_NAMESPACE::distance(v_stream.begin(), v_stream.end()) << " "
+		<< *v_list_it << " " << *v_stream_it << std::endl;
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== push_back | pop_back =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_pushpop;
@@ -208,6 +264,20 @@ int main() {
 	printContainers(v_swapA);
 	printContainers(v_swapB);
 
+	v_swapA.swap(v_swapA);
+	std::cout << "after self swap: " << std::endl;
+	printContainers(v_swapA);
+
+	TESTED_NAMESPACE::vector<no_equal> v_neA(4);
+	TESTED_NAMESPACE::vector<no_equal> v_neB(2);
+	for (unsigned int i = 0; i < v_neA.size(); ++i)
+		v_neA[i].value = i;
+	v_neB[0].value = 42;
+	v_neB[1].value = 43;
+	v_neA.swap(v_neB);
+	std::cout << "swap without operator==: " << v_neA.size() << " " << v_neA[0].value << " "
+		<< v_neB.size() << " " << v_neB[3].value << std::endl;
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== clear =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_clear(7);
@@ -221,6 +291,42 @@ int main() {
 	std::cout << "after clear: " << std::endl;
 	printContainers(v_clear);
 
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== erase | insert with non-trivial elements =====" << std::endl;
+	{
+		TESTED_NAMESPACE::vector<tracked> v_tr;
+		v_tr.reserve(16);
+		for (int i = 0; i < 5; ++i)
+			v_tr.push_back(tracked(i));
+		std::cout << "live: " << tracked::live << std::endl;
+
+		v_tr.erase(v_tr.begin() + 1);
+		std::cout << "erase(begin + 1) live: " << tracked::live << std::endl;
+		printContainers(v_tr);
+
+		v_tr.erase(v_tr.begin() + 1, v_tr.begin() + 1);
+		std::cout << "erase(empty range) live: " << tracked::live << std::endl;
+		printContainers(v_tr);
+
+		v_tr.erase(v_tr.begin(), v_tr.begin() + 2);
+		std::cout << "erase(begin, begin + 2) live: " << tracked::live << std::endl;
+		printContainers(v_tr);
+
+		v_tr.insert(v_tr.begin(), 2, tracked(7));
+		std::cout << "insert(begin, 2, 7) live: " << tracked::live << std::endl;
+		printContainers(v_tr);
+
+		TESTED_NAMESPACE::vector<tracked> v_src(3, tracked(9));
+		v_tr.insert(v_tr.begin() + 1, v_src.begin(), v_src.end());
+		std::cout << "insert(begin + 1, range) live: " << tracked::live << std::endl;
+		printContainers(v_tr);
+
+		v_tr.erase(v_tr.end() - 1);
+		std::cout << "erase(end - 1) live: " << tracked::live << std::endl;
+		printContainers(v_tr);
+	}
+	std::cout << "after scope live: " << tracked::live << std::endl;
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== relational operators =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_lhs(5);
@@ -249,4 +355,23 @@ int main() {
 	std::cout << "operator<=: " << ((v_lhs <= v_rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>:  " << ((v_lhs > v_rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>=: " << ((v_lhs >= v_rhs) ? "OK" : "KO") << std::endl;
+
+#if __cplusplus >= 201103L
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== move | emplace (c++11) =====" << std::endl;
+	TESTED_NAMESPACE::vector<std::string> v_str;
+	for (int i = 0; i < 5; ++i)
+		v_str.emplace_back(3, static_cast<char>('a' + i));
+	v_str.emplace(v_str.begin() + 2, "mid");
+	std::string moved("moved");
+	v_str.push_back(std::move(moved));
+	v_str.insert(v_str.begin(), std::string("front"));
+	v_str.emplace(v_str.begin() + 1, v_str.back());
+	printContainers(v_str);
+	TESTED_NAMESPACE::vector<std::string> v_moved(std::move(v_str));
+	std::cout << "after move constructor: " << v_str.size() << " " << v_moved.size() << std::endl;
+	v_str = std::move(v_moved);
+	std::cout << "after move assignment: " << v_str.size() << " " << v_moved.size() << std::endl;
+	printContainers(v_str);
+#endif
 }